@@ -0,0 +1,58 @@
+#include "GizmoRenderer.h"
+#include "AABB.h"
+#include "Circle.h"
+#include "OBB.h"
+#include "Plane.h"
+#include "Gizmos.h"
+
+#include <glm/ext.hpp>
+
+void GizmoRenderer::Draw(const World& PhysicsWorld)
+{
+	for (auto Actor : PhysicsWorld.GetBodies().Owners)
+		Draw(*Actor);
+}
+
+void GizmoRenderer::Draw(const Object& Actor)
+{
+	switch (Actor.GetShape())
+	{
+	case AABB:
+	{
+		const class AABB& Box = static_cast<const class AABB&>(Actor);
+
+		aie::Gizmos::add2DAABBFilled(Box.GetLocation(), Box.GetExtent(), Box.GetColor());
+		break;
+	}
+	case OBB:
+	{
+		const class OBB& Box = static_cast<const class OBB&>(Actor);
+		const glm::mat4 Transform = Box.GetTransform();
+
+		aie::Gizmos::add2DAABBFilled(Box.GetLocation(), Box.GetExtent(), Box.GetColor(), &Transform);
+		aie::Gizmos::add2DCircle(Box.GetLocation(), 0.5f, 30, { 1.0f, 1.0f, 1.0f, 1.0f });
+		break;
+	}
+	case CIRCLE:
+	{
+		const ::Circle& Ball = static_cast<const ::Circle&>(Actor);
+		const glm::vec2 Location = Ball.GetLocation();
+
+		aie::Gizmos::add2DCircle(Location, Ball.GetRadius(), 30, Ball.GetColor());
+
+		// A spoke so the spin is visible
+		const glm::vec2 End = Ball.GetRotor() * Ball.GetRadius();
+		aie::Gizmos::add2DLine(Location, Location + End, { 1.0f, 1.0f, 1.0f, 1.0f });
+		break;
+	}
+	case PLANE:
+	{
+		const Plane& Line = static_cast<const Plane&>(Actor);
+
+		aie::Gizmos::add2DLine(Line.GetStart(), Line.GetEnd(), Line.GetColor());
+		break;
+	}
+	default:
+		break;
+	}
+}
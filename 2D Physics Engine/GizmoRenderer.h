@@ -0,0 +1,10 @@
+#pragma once
+#include "World.h"
+
+// Draws a World with the bootstrap Gizmos. The physics core knows nothing about rendering, so this is the only place shapes turn into lines
+class GizmoRenderer
+{
+public:
+	static void Draw(const World& PhysicsWorld);
+	static void Draw(const Object& Actor);
+};
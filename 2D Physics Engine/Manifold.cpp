@@ -1,4 +0,0 @@
-#include "Manifold.h"
-
-Manifold::Manifold() = default;
-Manifold::~Manifold() = default;
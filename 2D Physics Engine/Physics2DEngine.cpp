@@ -6,11 +6,14 @@
 #include "Gizmos.h"
 #include "Plane.h"
 #include "OBB.h"
+#include "GizmoRenderer.h"
+#include "Trace.h"
 #include "../dependencies/glfw/include/GLFW/glfw3.h"
 
 #include <glm/gtc/matrix_transform.inl>
 #include <string.h>
 #include <string>
+#include <chrono>
 
 Physics2DEngine::Physics2DEngine() = default;
 Physics2DEngine::~Physics2DEngine() = default;
@@ -27,8 +30,14 @@ bool Physics2DEngine::Startup()
 	PhysicsWorld->Gravity = {0.0f, -19.81f};
 	PhysicsWorld->TimeStep = 0.01f;
 	
+	// Room for plenty of circles spawned with C, so pressing it never allocates
+	PhysicsWorld->ReservePool(CIRCLE, 512);
+
+	// A full launch moves the ball further than the barrier is wide in one step, so it is swept instead.
+	// It lives for the whole session, so it isn't pooled, leaving the window must not recycle it
 	Ball = new Circle({ 95.0f, -55.0f }, { 0.0f, -10.0f }, 3.0f, 1.5f, { 1, 0.992, 0.658, 1.0f });
 	Ball->SetKinematic(true);
+	Ball->SetBullet(true);
 	PhysicsWorld->AddActor(Ball);
 
 	// Slider settings
@@ -120,6 +129,9 @@ bool Physics2DEngine::Startup()
 
 void Physics2DEngine::Shutdown()
 {
+	// Whatever is still in the trace rings, so a problem session can be looked at after closing
+	Tracer::WriteChromeTrace("physics_trace.json");
+
 	delete Font;
 	delete Renderer;
 	delete PhysicsWorld;
@@ -185,14 +197,26 @@ void Physics2DEngine::Update(const float DeltaTime)
 		Ball->Collided = false;
 	}
 
-	// Spawn a circle
+	// Spawn a circle, from the World's pool so it is recycled once it falls out of the window
 	if (Input->wasKeyPressed(aie::INPUT_KEY_C))
-	{
-		const auto C = new Circle({ rand() % -20 - rand() % 20, 70.0f }, { 0.0f, -10.0f }, 3.0f, 1.5f, { 1, 0.992, 0.658, 1.0f });
-		PhysicsWorld->AddActor(C);
-	}
+		PhysicsWorld->SpawnCircle({ rand() % -20 - rand() % 20, 70.0f }, { 0.0f, -10.0f }, 3.0f, 1.5f, { 1, 0.992, 0.658, 1.0f });
+
+	const auto GizmoStart = std::chrono::high_resolution_clock::now();
+	GizmoRenderer::Draw(*PhysicsWorld);
+	Profiler.AddGizmoTime(std::chrono::duration<float, std::milli>(std::chrono::high_resolution_clock::now() - GizmoStart).count());
+
+	// Profiler overlay, P shows or hides it and H switches the hardware counters
+	if (Input->wasKeyPressed(aie::INPUT_KEY_P))
+		Profiler.Toggle();
+
+	if (Input->wasKeyPressed(aie::INPUT_KEY_H))
+		PhysicsWorld->SetHardwareCounters(!PhysicsWorld->HasHardwareCounters());
+
+	Profiler.Draw(PhysicsWorld->GetProfiler());
 
-	PhysicsWorld->UpdateGizmos();
+	// Dump the last few seconds of trace zones, open it in chrome://tracing or ui.perfetto.dev
+	if (Input->wasKeyPressed(aie::INPUT_KEY_T))
+		Tracer::WriteChromeTrace("physics_trace.json");
 
 	if (Input->isKeyDown(aie::INPUT_KEY_ESCAPE))
 		Quit();
@@ -3,6 +3,7 @@
 #include "Application.h"
 #include "Renderer2D.h"
 #include "World.h"
+#include "ProfilerOverlay.h"
 
 class Physics2DEngine final : public aie::Application
 {
@@ -25,6 +26,8 @@ protected:
 
 	World* PhysicsWorld{};
 
+	ProfilerOverlay Profiler;
+
 	Circle* Ball{};
 
 private:
@@ -0,0 +1,112 @@
+#include "ProfilerOverlay.h"
+#include "imgui.h"
+
+#include <cstdio>
+
+void ProfilerOverlay::AddGizmoTime(const float Milliseconds)
+{
+	GizmoHistory[NextGizmo] = Milliseconds;
+	NextGizmo = (NextGizmo + 1) % StepProfiler::HISTORY_LENGTH;
+}
+
+void ProfilerOverlay::DrawCounters(const StepProfiler& Profiler, const StepStats& Average)
+{
+	ImGui::Separator();
+
+	if (!Profiler.HasCounters())
+	{
+		ImGui::TextDisabled("Hardware counters off or unavailable (H)");
+		return;
+	}
+
+	// Averages per update, one column per counter the kernel gave us
+	const PerfCounters& Counters = Profiler.GetCounters();
+
+	ImGui::Columns(COUNTER_COUNT + 2, "Counters");
+	ImGui::Text("Phase");
+	ImGui::NextColumn();
+
+	for (int Counter = 0; Counter < COUNTER_COUNT; Counter++)
+	{
+		ImGui::Text("%s", PerfCounters::GetCounterName(static_cast<PerfCounter>(Counter)));
+		ImGui::NextColumn();
+	}
+
+	ImGui::Text("IPC");
+	ImGui::NextColumn();
+	ImGui::Separator();
+
+	for (int Phase = 0; Phase < PHASE_COUNT; Phase++)
+	{
+		const unsigned long long* Values = Average.Counters[Phase];
+
+		ImGui::Text("%s", StepProfiler::GetPhaseName(static_cast<StepPhase>(Phase)));
+		ImGui::NextColumn();
+
+		for (int Counter = 0; Counter < COUNTER_COUNT; Counter++)
+		{
+			if (Counters.IsAvailable(static_cast<PerfCounter>(Counter)))
+				ImGui::Text("%llu", Values[Counter]);
+			else
+				ImGui::TextDisabled("-");
+
+			ImGui::NextColumn();
+		}
+
+		if (Values[COUNTER_CYCLES] > 0)
+			ImGui::Text("%.2f", static_cast<double>(Values[COUNTER_INSTRUCTIONS]) / Values[COUNTER_CYCLES]);
+		else
+			ImGui::TextDisabled("-");
+
+		ImGui::NextColumn();
+	}
+
+	ImGui::Columns(1);
+}
+
+void ProfilerOverlay::Draw(const StepProfiler& Profiler)
+{
+	if (!bVisible)
+		return;
+
+	ImGui::SetNextWindowSize(ImVec2(360.0f, 0.0f), ImGuiSetCond_FirstUseEver);
+
+	if (!ImGui::Begin("Physics Profiler", &bVisible))
+	{
+		ImGui::End();
+		return;
+	}
+
+	const StepStats& Last = Profiler.GetFrame(0);
+	const StepStats Average = Profiler.GetAverage();
+
+	ImGui::Text("Step %.3f ms (avg %.3f ms)", Last.TotalTime, Average.TotalTime);
+	ImGui::Text("Substeps %u  Awake %u", Last.Substeps, Last.BodiesAwake);
+	ImGui::Text("Pairs %u  Contacts %u", Last.PairsTested, Last.ContactsProduced);
+	ImGui::Separator();
+
+	// Each phase is plotted straight out of the ring, striding over the rest of the stats
+	const StepStats* History = Profiler.GetHistory();
+	const int Offset = Profiler.GetHistoryOffset();
+	const int Count = StepProfiler::HISTORY_LENGTH;
+	char Overlay[32];
+
+	for (int Phase = 0; Phase < PHASE_COUNT; Phase++)
+	{
+		snprintf(Overlay, sizeof(Overlay), "%.3f ms", Average.PhaseTime[Phase]);
+		ImGui::PlotHistogram(StepProfiler::GetPhaseName(static_cast<StepPhase>(Phase)), &History[0].PhaseTime[Phase], Count, Offset, Overlay, 0.0f, FLT_MAX, ImVec2(0.0f, 40.0f), sizeof(StepStats));
+	}
+
+	float GizmoAverage = 0.0f;
+	for (const float Time : GizmoHistory)
+		GizmoAverage += Time / Count;
+
+	snprintf(Overlay, sizeof(Overlay), "%.3f ms", GizmoAverage);
+	ImGui::PlotHistogram("Gizmos", GizmoHistory, Count, NextGizmo, Overlay, 0.0f, FLT_MAX, ImVec2(0.0f, 40.0f));
+
+	ImGui::PlotLines("Total", &History[0].TotalTime, Count, Offset, nullptr, 0.0f, FLT_MAX, ImVec2(0.0f, 40.0f), sizeof(StepStats));
+
+	DrawCounters(Profiler, Average);
+
+	ImGui::End();
+}
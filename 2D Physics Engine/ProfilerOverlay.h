@@ -0,0 +1,23 @@
+#pragma once
+#include "StepProfiler.h"
+
+// ImGui panel showing where the physics step and the gizmo building spend their time
+class ProfilerOverlay
+{
+public:
+	void Draw(const StepProfiler& Profiler);
+
+	// Gizmos are built by the app, so it times them and hands the result over every frame
+	void AddGizmoTime(float Milliseconds);
+
+	void Toggle() { bVisible = !bVisible; }
+	bool IsVisible() const { return bVisible; }
+
+private:
+	bool bVisible{true};
+
+	void DrawCounters(const StepProfiler& Profiler, const StepStats& Average);
+
+	float GizmoHistory[StepProfiler::HISTORY_LENGTH]{};
+	unsigned int NextGizmo{};
+};
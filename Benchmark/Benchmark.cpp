@@ -0,0 +1,337 @@
+#include "Scenes.h"
+#include "Integrator.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+
+#if defined(_WIN32)
+#include <windows.h>
+#include <psapi.h>
+#else
+#include <sys/resource.h>
+#endif
+
+// Runs the canonical stress scenes headless and writes the results as JSON, so runs can be compared across commits.
+// PhysicsBenchmark [--scene name] [--count n] [--steps n] [--threads n] [--broadphase brute|grid|sap|tree] [--no-sleep] [--verify] [--out file]
+// --verify skips the timings and instead checks every SIMD integrator path the CPU has against the scalar one,
+// and that the scenes meant to come to rest are asleep after the steps
+
+typedef void(*SceneBuilder)(BenchmarkScene& Scene, unsigned int Count);
+
+struct SceneEntry
+{
+	const char* Name;
+	SceneBuilder Build;
+	unsigned int DefaultCount;
+
+	// Everything in the scene should be asleep by the end of a run, which --verify checks
+	bool bSettles;
+};
+
+static const SceneEntry SCENES[] =
+{
+	{ "rain", SceneGenerator::Rain, 2000, false },
+	{ "pyramid", SceneGenerator::Pyramid, 40, true },
+	{ "obb_pile", SceneGenerator::OBBPile, 1500, false },
+	{ "obb_stack", SceneGenerator::OBBStack, 200, true },
+	{ "circle_pool", SceneGenerator::CirclePool, 4000, false },
+	{ "mixed", SceneGenerator::Mixed, 10500, false },
+};
+
+static const char* BROADPHASE_NAMES[] = { "brute", "grid", "sap", "tree" };
+
+struct BenchmarkOptions
+{
+	const char* Scene{};
+	unsigned int Count{};
+	unsigned int Steps{600};
+	unsigned int Threads{1};
+	BroadphaseMethod Method{UNIFORM_GRID};
+	bool bSleeping{true};
+	bool bVerify{};
+	const char* OutPath{};
+};
+
+// Peak resident memory of the whole process so far, it never goes down between scenes
+static unsigned long long GetPeakMemoryKB()
+{
+#if defined(_WIN32)
+	PROCESS_MEMORY_COUNTERS Counters;
+
+	if (GetProcessMemoryInfo(GetCurrentProcess(), &Counters, sizeof(Counters)))
+		return Counters.PeakWorkingSetSize / 1024;
+
+	return 0;
+#else
+	rusage Usage;
+
+	if (getrusage(RUSAGE_SELF, &Usage) == 0)
+		return Usage.ru_maxrss;
+
+	return 0;
+#endif
+}
+
+static bool HasScene(const char* Name)
+{
+	for (const SceneEntry& Entry : SCENES)
+	{
+		if (strcmp(Name, Entry.Name) == 0)
+			return true;
+	}
+
+	return false;
+}
+
+static bool ParseOptions(const int Count, char** Arguments, BenchmarkOptions& Options)
+{
+	for (int i = 1; i < Count; i++)
+	{
+		const char* Argument = Arguments[i];
+		const bool bHasValue = i + 1 < Count;
+
+		if (strcmp(Argument, "--no-sleep") == 0)
+			Options.bSleeping = false;
+		else if (strcmp(Argument, "--verify") == 0)
+			Options.bVerify = true;
+		else if (strcmp(Argument, "--scene") == 0 && bHasValue)
+			Options.Scene = Arguments[++i];
+		else if (strcmp(Argument, "--count") == 0 && bHasValue)
+			Options.Count = strtoul(Arguments[++i], nullptr, 10);
+		else if (strcmp(Argument, "--steps") == 0 && bHasValue)
+			Options.Steps = strtoul(Arguments[++i], nullptr, 10);
+		else if (strcmp(Argument, "--threads") == 0 && bHasValue)
+			Options.Threads = strtoul(Arguments[++i], nullptr, 10);
+		else if (strcmp(Argument, "--out") == 0 && bHasValue)
+			Options.OutPath = Arguments[++i];
+		else if (strcmp(Argument, "--broadphase") == 0 && bHasValue)
+		{
+			const char* Name = Arguments[++i];
+			bool bFound = false;
+
+			for (int Method = BRUTE_FORCE; Method <= DYNAMIC_TREE; Method++)
+			{
+				if (strcmp(Name, BROADPHASE_NAMES[Method]) == 0)
+				{
+					Options.Method = static_cast<BroadphaseMethod>(Method);
+					bFound = true;
+				}
+			}
+
+			if (!bFound)
+				return false;
+		}
+		else
+			return false;
+	}
+
+	return true;
+}
+
+static void RunScene(const SceneEntry& Entry, const BenchmarkOptions& Options, FILE* Out, const bool bFirst)
+{
+	BenchmarkScene Scene;
+	Scene.Physics.SetBroadphase(Options.Method);
+	Scene.Physics.SetThreadCount(Options.Threads);
+	Scene.Physics.SetSleeping(Options.bSleeping);
+
+	const unsigned int Count = Options.Count > 0 ? Options.Count : Entry.DefaultCount;
+	Entry.Build(Scene, Count);
+
+	const unsigned int Bodies = Scene.Physics.GetBodies().GetCount();
+
+	// The profiler only keeps the last few hundred updates, so add every one up here
+	double PhaseTotals[PHASE_COUNT]{};
+	unsigned long long Pairs = 0, Contacts = 0, Substeps = 0;
+
+	const auto Start = std::chrono::steady_clock::now();
+
+	for (unsigned int Step = 0; Step < Options.Steps; Step++)
+	{
+		Scene.Physics.Update(Scene.Physics.TimeStep);
+
+		const StepStats& Stats = Scene.Physics.GetProfiler().GetFrame(0);
+
+		for (int Phase = 0; Phase < PHASE_COUNT; Phase++)
+			PhaseTotals[Phase] += Stats.PhaseTime[Phase];
+
+		Pairs += Stats.PairsTested;
+		Contacts += Stats.ContactsProduced;
+		Substeps += Stats.Substeps;
+	}
+
+	const double Seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - Start).count();
+	const double PerStep = Substeps > 0 ? 1.0 / Substeps : 0.0;
+
+	fprintf(Out, "%s\n    {\n", bFirst ? "" : ",");
+	fprintf(Out, "      \"name\": \"%s\",\n", Entry.Name);
+	fprintf(Out, "      \"count\": %u,\n", Count);
+	fprintf(Out, "      \"bodies\": %u,\n", Bodies);
+	fprintf(Out, "      \"bodies_left\": %u,\n", Scene.Physics.GetBodies().GetCount());
+	fprintf(Out, "      \"bodies_awake\": %u,\n", Scene.Physics.GetProfiler().GetFrame(0).BodiesAwake);
+	fprintf(Out, "      \"steps\": %llu,\n", Substeps);
+	fprintf(Out, "      \"seconds\": %.6f,\n", Seconds);
+	fprintf(Out, "      \"steps_per_second\": %.3f,\n", Seconds > 0.0 ? Substeps / Seconds : 0.0);
+	fprintf(Out, "      \"pairs_per_step\": %.1f,\n", Pairs * PerStep);
+	fprintf(Out, "      \"contacts_per_step\": %.1f,\n", Contacts * PerStep);
+	fprintf(Out, "      \"phase_ms_per_step\": {");
+
+	for (int Phase = 0; Phase < PHASE_COUNT; Phase++)
+		fprintf(Out, "%s\"%s\": %.6f", Phase == 0 ? " " : ", ", StepProfiler::GetPhaseName(static_cast<StepPhase>(Phase)), PhaseTotals[Phase] * PerStep);
+
+	fprintf(Out, " },\n");
+	fprintf(Out, "      \"peak_memory_kb\": %llu\n", GetPeakMemoryKB());
+	fprintf(Out, "    }");
+	fflush(Out);
+}
+
+// Largest difference between two stores relative to the scalar value, floored at 1 so values near zero are compared absolutely
+static float GetRelativeError(const std::vector<float>& Reference, const std::vector<float>& Values)
+{
+	float Error = 0.0f;
+
+	for (size_t i = 0; i < Reference.size(); i++)
+		Error = std::max(Error, fabsf(Values[i] - Reference[i]) / std::max(1.0f, fabsf(Reference[i])));
+
+	return Error;
+}
+
+// Integrates copies of the scene's bodies on the scalar path and on each SIMD path for the same number of steps. The
+// rest of the step is left out so the contacts can't amplify a last bit difference into a different pile.
+// Scenes that should come to rest are then stepped for real to check they fall asleep
+static bool VerifyScene(const SceneEntry& Entry, const BenchmarkOptions& Options, FILE* Out, bool& bFirst)
+{
+	static const char* PATH_NAMES[] = { "scalar", "sse", "avx" };
+
+	BenchmarkScene Scene;
+	const unsigned int Count = Options.Count > 0 ? Options.Count : Entry.DefaultCount;
+	Entry.Build(Scene, Count);
+
+	const World& Physics = Scene.Physics;
+	BodyStore Reference = Physics.GetBodies();
+
+	for (unsigned int Step = 0; Step < Options.Steps; Step++)
+		Integrator::Integrate(Reference, Physics.Gravity, Physics.TimeStep, INTEGRATOR_SCALAR);
+
+	bool bPassed = true;
+
+	for (int Path = INTEGRATOR_SSE; Path <= Integrator::DetectPath(); Path++)
+	{
+		BodyStore Bodies = Physics.GetBodies();
+
+		for (unsigned int Step = 0; Step < Options.Steps; Step++)
+			Integrator::Integrate(Bodies, Physics.Gravity, Physics.TimeStep, static_cast<IntegratorPath>(Path));
+
+		float Error = 0.0f;
+		Error = std::max(Error, GetRelativeError(Reference.PositionX, Bodies.PositionX));
+		Error = std::max(Error, GetRelativeError(Reference.PositionY, Bodies.PositionY));
+		Error = std::max(Error, GetRelativeError(Reference.VelocityX, Bodies.VelocityX));
+		Error = std::max(Error, GetRelativeError(Reference.VelocityY, Bodies.VelocityY));
+		Error = std::max(Error, GetRelativeError(Reference.RotationCos, Bodies.RotationCos));
+		Error = std::max(Error, GetRelativeError(Reference.RotationSin, Bodies.RotationSin));
+		Error = std::max(Error, GetRelativeError(Reference.AngularVelocity, Bodies.AngularVelocity));
+
+		const bool bWithinTolerance = Error < INTEGRATOR_TOLERANCE;
+		bPassed = bPassed && bWithinTolerance;
+
+		fprintf(Out, "%s\n    {\n", bFirst ? "" : ",");
+		fprintf(Out, "      \"name\": \"%s\",\n", Entry.Name);
+		fprintf(Out, "      \"bodies\": %u,\n", Bodies.GetCount());
+		fprintf(Out, "      \"path\": \"%s\",\n", PATH_NAMES[Path]);
+		fprintf(Out, "      \"max_relative_error\": %g,\n", Error);
+		fprintf(Out, "      \"tolerance\": %g,\n", INTEGRATOR_TOLERANCE);
+		fprintf(Out, "      \"passed\": %s\n", bWithinTolerance ? "true" : "false");
+		fprintf(Out, "    }");
+		fflush(Out);
+
+		if (!bWithinTolerance)
+			fprintf(stderr, "%s: %s path is %g off the scalar one\n", Entry.Name, PATH_NAMES[Path], Error);
+
+		bFirst = false;
+	}
+
+	if (!Entry.bSettles)
+		return bPassed;
+
+	for (unsigned int Step = 0; Step < Options.Steps; Step++)
+		Scene.Physics.Update(Scene.Physics.TimeStep);
+
+	const unsigned int Awake = Scene.Physics.GetProfiler().GetFrame(0).BodiesAwake;
+	bPassed = bPassed && Awake == 0;
+
+	fprintf(Out, "%s\n    {\n", bFirst ? "" : ",");
+	fprintf(Out, "      \"name\": \"%s\",\n", Entry.Name);
+	fprintf(Out, "      \"bodies\": %u,\n", Physics.GetBodies().GetCount());
+	fprintf(Out, "      \"bodies_awake\": %u,\n", Awake);
+	fprintf(Out, "      \"passed\": %s\n", Awake == 0 ? "true" : "false");
+	fprintf(Out, "    }");
+	fflush(Out);
+
+	if (Awake != 0)
+		fprintf(stderr, "%s: %u bodies still awake after %u steps\n", Entry.Name, Awake, Options.Steps);
+
+	bFirst = false;
+
+	return bPassed;
+}
+
+int main(const int Count, char** Arguments)
+{
+	BenchmarkOptions Options;
+
+	if (!ParseOptions(Count, Arguments, Options))
+	{
+		fprintf(stderr, "usage: %s [--scene name] [--count n] [--steps n] [--threads n] [--broadphase brute|grid|sap|tree] [--no-sleep] [--verify] [--out file]\n", Arguments[0]);
+		return 1;
+	}
+
+	if (Options.Scene != nullptr && !HasScene(Options.Scene))
+	{
+		fprintf(stderr, "no scene called %s\n", Options.Scene);
+		return 1;
+	}
+
+	FILE* Out = Options.OutPath != nullptr ? fopen(Options.OutPath, "w") : stdout;
+
+	if (Out == nullptr)
+	{
+		fprintf(stderr, "could not open %s\n", Options.OutPath);
+		return 1;
+	}
+
+	fprintf(Out, "{\n");
+	fprintf(Out, "  \"broadphase\": \"%s\",\n", BROADPHASE_NAMES[Options.Method]);
+	fprintf(Out, "  \"threads\": %u,\n", Options.Threads);
+	fprintf(Out, "  \"sleeping\": %s,\n", Options.bSleeping ? "true" : "false");
+	fprintf(Out, "  \"steps\": %u,\n", Options.Steps);
+	fprintf(Out, "  \"scenes\": [");
+
+	bool bFirst = true;
+	bool bPassed = true;
+
+	for (const SceneEntry& Entry : SCENES)
+	{
+		if (Options.Scene != nullptr && strcmp(Options.Scene, Entry.Name) != 0)
+			continue;
+
+		if (Options.bVerify)
+			bPassed = VerifyScene(Entry, Options, Out, bFirst) && bPassed;
+		else
+		{
+			RunScene(Entry, Options, Out, bFirst);
+			bFirst = false;
+		}
+	}
+
+	fprintf(Out, "\n  ]\n}\n");
+
+	if (Out != stdout)
+		fclose(Out);
+
+	return bPassed ? 0 : 1;
+}
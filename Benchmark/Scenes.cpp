@@ -0,0 +1,164 @@
+#include "Scenes.h"
+#include "AABB.h"
+#include "Circle.h"
+#include "OBB.h"
+#include "Plane.h"
+
+#include <cmath>
+
+static const float BOX_EXTENT = 95.0f;
+static const unsigned int SEED = 12345;
+
+void BenchmarkScene::Add(Object* Actor)
+{
+	Actors.emplace_back(Actor);
+	Physics.AddActor(Actor);
+}
+
+void SceneGenerator::Rain(BenchmarkScene& Scene, const unsigned int Count)
+{
+	Setup(Scene);
+	AddBox(Scene);
+
+	// Staggered rows of pegs, like the pachinko board in the app
+	for (int Row = 0; Row < 10; Row++)
+	{
+		const float Offset = Row % 2 == 0 ? 0.0f : 4.0f;
+
+		for (float X = -88.0f + Offset; X < 90.0f; X += 8.0f)
+		{
+			const auto Peg = new Circle({ X, 40.0f - Row * 10.0f }, {}, 1.0f, 4.0f, WHITE);
+			Peg->SetKinematic(true);
+			Scene.Add(Peg);
+		}
+	}
+
+	unsigned int Seed = SEED;
+
+	for (unsigned int i = 0; i < Count; i++)
+	{
+		const glm::vec2 Location = { Random(Seed, -90.0f, 90.0f), Random(Seed, 50.0f, 94.0f) };
+		Scene.Add(new Circle(Location, { 0.0f, -10.0f }, 0.75f, 1.0f, YELLOW));
+	}
+}
+
+void SceneGenerator::Pyramid(BenchmarkScene& Scene, const unsigned int Count)
+{
+	Setup(Scene);
+	AddBox(Scene);
+
+	const float Size = 2.0f;
+
+	for (unsigned int Row = 0; Row < Count; Row++)
+	{
+		const unsigned int Boxes = Count - Row;
+		const float Left = -(Boxes - 1.0f) * Size * 0.5f;
+
+		for (unsigned int i = 0; i < Boxes; i++)
+		{
+			const glm::vec2 Location = { Left + i * Size, -BOX_EXTENT + Size * 0.5f + Row * Size };
+			Scene.Add(new class AABB(Location, {}, Size, Size, 1.0f, BLUE));
+		}
+	}
+}
+
+void SceneGenerator::OBBPile(BenchmarkScene& Scene, const unsigned int Count)
+{
+	Setup(Scene);
+	AddBox(Scene);
+
+	unsigned int Seed = SEED;
+
+	// A loose grid, so nothing starts overlapping, with every box spinning in at its own angle
+	const unsigned int Columns = 60;
+
+	for (unsigned int i = 0; i < Count; i++)
+	{
+		const glm::vec2 Location = { -88.0f + (i % Columns) * 3.0f, -80.0f + (i / Columns) * 3.0f };
+		const glm::vec2 Velocity = { Random(Seed, -10.0f, 10.0f), Random(Seed, -10.0f, 0.0f) };
+
+		Scene.Add(new class OBB(Location, Velocity, { 0.8f, 0.8f }, Random(Seed, 0.0f, 90.0f), 1.0f, GREEN));
+	}
+}
+
+void SceneGenerator::OBBStack(BenchmarkScene& Scene, const unsigned int Count)
+{
+	Setup(Scene);
+	AddBox(Scene);
+
+	const float Size = 2.0f;
+	const unsigned int Height = 10;
+
+	// Towers two boxes apart, so each one only stands on its own contacts
+	for (unsigned int i = 0; i < Count; i++)
+	{
+		const glm::vec2 Location = { -88.0f + (i / Height) * Size * 2.0f, -BOX_EXTENT + Size * 0.5f + (i % Height) * Size };
+		Scene.Add(new class OBB(Location, {}, { Size * 0.5f, Size * 0.5f }, 0.0f, 1.0f, GREEN));
+	}
+}
+
+void SceneGenerator::CirclePool(BenchmarkScene& Scene, const unsigned int Count)
+{
+	Setup(Scene);
+	AddBox(Scene);
+
+	const float Radius = 0.75f;
+	const unsigned int Columns = static_cast<unsigned int>(BOX_EXTENT * 2.0f / (Radius * 2.0f)) - 1;
+
+	for (unsigned int i = 0; i < Count; i++)
+	{
+		const glm::vec2 Location = { -BOX_EXTENT + Radius * 2.0f * (i % Columns + 1), -BOX_EXTENT + Radius * 2.0f * (i / Columns + 0.5f) };
+		Scene.Add(new Circle(Location, {}, Radius, 1.0f, LIGHT_BLUE));
+	}
+}
+
+void SceneGenerator::Mixed(BenchmarkScene& Scene, const unsigned int Count)
+{
+	Setup(Scene);
+	AddBox(Scene);
+
+	// Smaller cells suit the small shapes packed in here
+	Scene.Physics.SetGridCellSize(3.0f);
+
+	unsigned int Seed = SEED;
+
+	const float Spacing = 1.8f;
+	const unsigned int Columns = static_cast<unsigned int>(BOX_EXTENT * 2.0f / Spacing) - 1;
+
+	for (unsigned int i = 0; i < Count; i++)
+	{
+		const glm::vec2 Location = { -BOX_EXTENT + Spacing * (i % Columns + 1), -BOX_EXTENT + Spacing * (i / Columns + 0.5f) };
+
+		switch (i % 3)
+		{
+		case 0:
+			Scene.Add(new Circle(Location, {}, 0.6f, 1.0f, YELLOW));
+			break;
+		case 1:
+			Scene.Add(new class AABB(Location, {}, 1.2f, 1.2f, 1.0f, BLUE));
+			break;
+		default:
+			Scene.Add(new class OBB(Location, {}, { 0.6f, 0.6f }, Random(Seed, 0.0f, 90.0f), 1.0f, GREEN));
+			break;
+		}
+	}
+}
+
+void SceneGenerator::AddBox(BenchmarkScene& Scene)
+{
+	Scene.Add(new Plane({ 0.0f, 1.0f }, -BOX_EXTENT, 300.0f));
+	Scene.Add(new Plane({ 1.0f, 0.0f }, -BOX_EXTENT, 300.0f));
+	Scene.Add(new Plane({ 1.0f, 0.0f }, BOX_EXTENT, 300.0f));
+}
+
+void SceneGenerator::Setup(BenchmarkScene& Scene)
+{
+	Scene.Physics.Gravity = { 0.0f, -19.81f };
+	Scene.Physics.TimeStep = 1.0f / 60.0f;
+}
+
+float SceneGenerator::Random(unsigned int& Seed, const float Min, const float Max)
+{
+	Seed = Seed * 1664525u + 1013904223u;
+	return Min + (Max - Min) * ((Seed >> 8) / 16777216.0f);
+}
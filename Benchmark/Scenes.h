@@ -0,0 +1,46 @@
+#pragma once
+#include "World.h"
+
+#include <memory>
+#include <vector>
+
+// A World plus the actors in it. The World doesn't own its actors, so the scene does
+struct BenchmarkScene
+{
+	std::vector<std::unique_ptr<Object>> Actors;
+	World Physics;
+
+	void Add(Object* Actor);
+};
+
+// The canonical stress scenes. Every one is built from a fixed seed, so the same count gives the same scene on every run and platform
+class SceneGenerator
+{
+public:
+	// Circles dropped onto a board of kinematic pegs
+	static void Rain(BenchmarkScene& Scene, unsigned int Count);
+
+	// Count rows of AABBs stacked into a pyramid on the floor
+	static void Pyramid(BenchmarkScene& Scene, unsigned int Count);
+
+	// OBBs at random angles thrown into a pile
+	static void OBBPile(BenchmarkScene& Scene, unsigned int Count);
+
+	// Count OBBs stacked square into towers ten high, which should come to rest and sleep
+	static void OBBStack(BenchmarkScene& Scene, unsigned int Count);
+
+	// Circles packed shoulder to shoulder at the bottom of the box
+	static void CirclePool(BenchmarkScene& Scene, unsigned int Count);
+
+	// Circles, AABBs and OBBs filling the whole box
+	static void Mixed(BenchmarkScene& Scene, unsigned int Count);
+
+private:
+	// Walls and floor just inside the region a World keeps bodies in
+	static void AddBox(BenchmarkScene& Scene);
+
+	static void Setup(BenchmarkScene& Scene);
+
+	// Small LCG, rand() differs between standard libraries
+	static float Random(unsigned int& Seed, float Min, float Max);
+};
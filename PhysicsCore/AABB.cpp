@@ -1,5 +1,4 @@
 #include "AABB.h"
-#include "Gizmos.h"
 
 #include <glm/ext.hpp>
 #include <stdio.h>
@@ -19,9 +18,6 @@ AABB::AABB(const glm::vec2 Location, const glm::vec2 Velocity, const float Width
 	else
 		this->InverseMass = 1.0f / Mass;
 
-	this->Min = Location - Extent;
-	this->Max = Location + Extent;
-
 	this->AngularVelocity = 0.0f;
 	this->Moment = 1.0f;
 
@@ -34,34 +30,15 @@ AABB::AABB(const glm::vec2 Location, const glm::vec2 Velocity, const float Width
 
 AABB::~AABB() = default;
 
-void AABB::FixedUpdate(const glm::vec2 Gravity, const float TimeStep)
-{
-	Object::FixedUpdate(Gravity, TimeStep);
-
-	Min = Location - Extent;
-	Max = Location + Extent;
-}
-
 void AABB::Debug()
 {
-	printf("X: %f, Y: %f\n", Location.x, Location.y);
+	printf("X: %f, Y: %f\n", GetLocation().x, GetLocation().y);
 	printf("Size X: %f, Y:%f\n", Width, Height);
 	printf("Extent X: %f, Y:%f\n", Extent.x, Extent.y);
 }
 
-void AABB::MakeGizmo()
-{
-	// The AABB
-	aie::Gizmos::add2DAABBFilled(Location, Extent, Color);
-
-	// The extent locations
-	//aie::Gizmos::add2DCircle(Min, 1.0f, 30, { 0.0f, 1.0f, 0.0f, 1.0f });
-	//aie::Gizmos::add2DCircle(Max, 1.0f, 30, { 0.0f, 1.0f, 0.0f, 1.0f });
-	//
-	//// Location
-	//aie::Gizmos::add2DCircle(Location, 0.5f, 30, {1.0f, 0.0f, 0.0f, 1.0f});
 
-	// Lines at x and y
-	// aie::Gizmos::add2DLine(Location - Extent, Location + Extent, {1.0f, 1.0f, 1.0f, 1.0f});
+Bounds AABB::GetBounds() const
+{
+	return { GetMin(), GetMax() };
 }
-
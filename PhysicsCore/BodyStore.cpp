@@ -0,0 +1,237 @@
+﻿#include "BodyStore.h"
+#include "Object.h"
+#include "Circle.h"
+
+#include <cmath>
+#include <utility>
+
+BodyStore::BodyStore() = default;
+BodyStore::~BodyStore() = default;
+
+unsigned int BodyStore::Add(Object* Owner)
+{
+	const unsigned int Index = Owners.size();
+
+	unsigned int Slot;
+	if (!FreeSlots.empty())
+	{
+		Slot = FreeSlots.back();
+		FreeSlots.pop_back();
+	}
+	else
+	{
+		Slot = Generations.size();
+		Generations.push_back(0);
+		SlotIndex.push_back(0);
+	}
+
+	SlotIndex[Slot] = Index;
+	BodySlot.push_back(Slot);
+
+	Owners.push_back(Owner);
+
+	PositionX.push_back(Owner->Location.x);
+	PositionY.push_back(Owner->Location.y);
+	VelocityX.push_back(Owner->Velocity.x);
+	VelocityY.push_back(Owner->Velocity.y);
+	RotationCos.push_back(Owner->Rotor.x);
+	RotationSin.push_back(Owner->Rotor.y);
+	AngularVelocity.push_back(Owner->AngularVelocity);
+	Mass.push_back(Owner->Mass);
+	InverseMass.push_back(Owner->InverseMass);
+
+	// AABBs stay lined up with the world axes, so contacts must never turn them
+	InverseMoment.push_back(Owner->Moment != 0.0f && Owner->GetShape() != Geometry::AABB ? 1.0f / Owner->Moment : 0.0f);
+	LinearDrag.push_back(Owner->LinearDrag);
+	AngularDrag.push_back(Owner->AngularDrag);
+	Friction.push_back(Owner->Friction);
+	Radius.push_back(Owner->GetShape() == CIRCLE ? static_cast<Circle*>(Owner)->GetRadius() : 0.0f);
+	SleepTime.push_back(0.0f);
+
+	if ((Index >> 5) >= KinematicMask.size())
+	{
+		KinematicMask.push_back(0);
+		AwakeMask.push_back(0);
+		BulletMask.push_back(0);
+		MovedMask.push_back(0);
+	}
+
+	SetBit(AwakeMask, Index, true);
+	SetBit(BulletMask, Index, Owner->bIsBullet);
+
+	Owner->Store = this;
+	Owner->BodyIndex = Index;
+
+	// Lands at the end of the static range, SetKinematic moves it across if it can move
+	SetKinematic(Index, Owner->bIsKinematic);
+
+	return Owner->BodyIndex;
+}
+
+void BodyStore::Remove(unsigned int Index)
+{
+	Object* Owner = Owners[Index];
+
+	// Give the object its state back, so it still works on its own
+	Owner->Location = { PositionX[Index], PositionY[Index] };
+	Owner->Velocity = { VelocityX[Index], VelocityY[Index] };
+	Owner->Rotor = { RotationCos[Index], RotationSin[Index] };
+	Owner->AngularVelocity = AngularVelocity[Index];
+	Owner->LinearDrag = LinearDrag[Index];
+	Owner->AngularDrag = AngularDrag[Index];
+	Owner->bIsKinematic = IsKinematic(Index);
+	Owner->bIsBullet = IsBullet(Index);
+
+	Owner->Store = nullptr;
+
+	// Fill the hole from the end of its own range, then move the hole to the very end
+	if (Index < DynamicCount)
+	{
+		DynamicCount--;
+		Swap(Index, DynamicCount);
+		Index = DynamicCount;
+	}
+
+	const unsigned int Last = Owners.size() - 1;
+	Swap(Index, Last);
+
+	SetBit(KinematicMask, Last, false);
+	SetBit(AwakeMask, Last, false);
+	SetBit(BulletMask, Last, false);
+	SetBit(MovedMask, Last, false);
+
+	// Anything still holding the old handle sees it go stale
+	const unsigned int Slot = BodySlot[Last];
+	Generations[Slot]++;
+	FreeSlots.push_back(Slot);
+	BodySlot.pop_back();
+
+	Owners.pop_back();
+	PositionX.pop_back();
+	PositionY.pop_back();
+	VelocityX.pop_back();
+	VelocityY.pop_back();
+	RotationCos.pop_back();
+	RotationSin.pop_back();
+	AngularVelocity.pop_back();
+	Mass.pop_back();
+	InverseMass.pop_back();
+	InverseMoment.pop_back();
+	LinearDrag.pop_back();
+	AngularDrag.pop_back();
+	Friction.pop_back();
+	Radius.pop_back();
+	SleepTime.pop_back();
+}
+
+void BodyStore::ApplyForce(const unsigned int Index, const glm::vec2 Force)
+{
+	VelocityX[Index] += Force.x * InverseMass[Index];
+	VelocityY[Index] += Force.y * InverseMass[Index];
+	AngularVelocity[Index] += (Force.y * PositionX[Index] - Force.x * PositionY[Index]) * InverseMoment[Index];
+
+	SetAwake(Index, true);
+}
+
+void BodyStore::SetKinematic(const unsigned int Index, const bool State)
+{
+	SetBit(KinematicMask, Index, State);
+
+	// Kinematic bodies stop dead and lose their drag, the integrator never sees them again to do it
+	if (State)
+	{
+		VelocityX[Index] = 0.0f;
+		VelocityY[Index] = 0.0f;
+		AngularVelocity[Index] = 0.0f;
+		LinearDrag[Index] = 0.0f;
+		AngularDrag[Index] = 0.0f;
+	}
+
+	const bool bStatic = State || Owners[Index]->GetShape() == PLANE;
+
+	// Keep [0, DynamicCount) dynamic and the rest static
+	if (bStatic && Index < DynamicCount)
+	{
+		DynamicCount--;
+		Swap(Index, DynamicCount);
+	}
+	else if (!bStatic && Index >= DynamicCount)
+	{
+		Swap(Index, DynamicCount);
+		DynamicCount++;
+	}
+}
+
+void BodyStore::SetAwake(const unsigned int Index, const bool State)
+{
+	if (State)
+		SleepTime[Index] = 0.0f;
+	else
+	{
+		VelocityX[Index] = 0.0f;
+		VelocityY[Index] = 0.0f;
+		AngularVelocity[Index] = 0.0f;
+	}
+
+	SetBit(AwakeMask, Index, State);
+}
+
+void BodyStore::ClearMoved()
+{
+	for (unsigned int& Bits : MovedMask)
+		Bits = 0;
+}
+
+void BodyStore::SetBit(std::vector<unsigned int>& Mask, const unsigned int Index, const bool State)
+{
+	if (State)
+		Mask[Index >> 5] |= 1u << (Index & 31);
+	else
+		Mask[Index >> 5] &= ~(1u << (Index & 31));
+}
+
+void BodyStore::Swap(const unsigned int A, const unsigned int B)
+{
+	if (A == B)
+		return;
+
+	std::swap(Owners[A], Owners[B]);
+	std::swap(PositionX[A], PositionX[B]);
+	std::swap(PositionY[A], PositionY[B]);
+	std::swap(VelocityX[A], VelocityX[B]);
+	std::swap(VelocityY[A], VelocityY[B]);
+	std::swap(RotationCos[A], RotationCos[B]);
+	std::swap(RotationSin[A], RotationSin[B]);
+	std::swap(AngularVelocity[A], AngularVelocity[B]);
+	std::swap(Mass[A], Mass[B]);
+	std::swap(InverseMass[A], InverseMass[B]);
+	std::swap(InverseMoment[A], InverseMoment[B]);
+	std::swap(LinearDrag[A], LinearDrag[B]);
+	std::swap(AngularDrag[A], AngularDrag[B]);
+	std::swap(Friction[A], Friction[B]);
+	std::swap(Radius[A], Radius[B]);
+	std::swap(SleepTime[A], SleepTime[B]);
+
+	const bool bKinematicA = IsKinematic(A);
+	SetBit(KinematicMask, A, IsKinematic(B));
+	SetBit(KinematicMask, B, bKinematicA);
+
+	const bool bAwakeA = IsAwake(A);
+	SetBit(AwakeMask, A, IsAwake(B));
+	SetBit(AwakeMask, B, bAwakeA);
+
+	const bool bBulletA = IsBullet(A);
+	SetBit(BulletMask, A, IsBullet(B));
+	SetBit(BulletMask, B, bBulletA);
+
+	const bool bMovedA = IsMoved(A);
+	SetBit(MovedMask, A, IsMoved(B));
+	SetBit(MovedMask, B, bMovedA);
+
+	std::swap(BodySlot[A], BodySlot[B]);
+	SlotIndex[BodySlot[A]] = A;
+	SlotIndex[BodySlot[B]] = B;
+
+	Owners[A]->BodyIndex = A;
+	Owners[B]->BodyIndex = B;
+}
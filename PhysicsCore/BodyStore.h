@@ -0,0 +1,110 @@
+﻿#pragma once
+#include <glm/vec2.hpp>
+
+#include <vector>
+
+class Object;
+
+// Names a body for as long as it is in the store, wherever swaps move it to. Removing the body bumps the generation
+// of its slot, so old handles go stale instead of pointing at whatever reuses the slot
+struct BodyHandle
+{
+	unsigned int Slot{0xFFFFFFFF};
+	unsigned int Generation{};
+
+	bool operator==(const BodyHandle& Other) const { return Slot == Other.Slot && Generation == Other.Generation; }
+	bool operator!=(const BodyHandle& Other) const { return !(*this == Other); }
+};
+
+// Simulation state of every body in a World, one contiguous array per value.
+// Objects added to the World become handles into here, so integration is a single pass over plain floats (see Integrator).
+// Bodies that can move come first, kinematic bodies and planes after them, so the static ones can be skipped as a block
+class BodyStore
+{
+public:
+	BodyStore();
+	~BodyStore();
+
+	// Moves the object's state into the store. Returns the slot it was given
+	unsigned int Add(Object* Owner);
+
+	// Hands the state back to the object and fills the hole from the end of its range
+	void Remove(unsigned int Index);
+
+	void ApplyForce(unsigned int Index, glm::vec2 Force);
+
+	BodyHandle GetHandle(const unsigned int Index) const { return { BodySlot[Index], Generations[BodySlot[Index]] }; }
+
+	bool IsValid(const BodyHandle Handle) const { return Handle.Slot < Generations.size() && Generations[Handle.Slot] == Handle.Generation; }
+
+	// The body behind a handle, nullptr once it has been removed
+	Object* Get(const BodyHandle Handle) const { return IsValid(Handle) ? Owners[SlotIndex[Handle.Slot]] : nullptr; }
+
+	unsigned int GetCount() const { return Owners.size(); }
+
+	// Bodies [0, GetDynamicCount()) can move
+	unsigned int GetDynamicCount() const { return DynamicCount; }
+
+	bool IsKinematic(const unsigned int Index) const { return (KinematicMask[Index >> 5] & (1u << (Index & 31))) != 0; }
+
+	// Moves the body between the dynamic and static ranges, so the body at Index may change
+	void SetKinematic(unsigned int Index, bool State);
+
+	// Sleeping bodies are skipped by the integrator and the narrowphase until something wakes them
+	bool IsAwake(const unsigned int Index) const { return (AwakeMask[Index >> 5] & (1u << (Index & 31))) != 0; }
+
+	// Waking restarts the sleep timer, going to sleep stops the body dead
+	void SetAwake(unsigned int Index, bool State);
+
+	// Bullets get their motion swept against the static bodies each step, so they can't pass through them
+	bool IsBullet(const unsigned int Index) const { return (BulletMask[Index >> 5] & (1u << (Index & 31))) != 0; }
+	void SetBullet(const unsigned int Index, const bool State) { SetBit(BulletMask, Index, State); }
+
+	// Static and sleeping bodies only move when SetLocation is called on them. The broadphases keep their bounds from
+	// the last step unless they are flagged here, and the World clears the flags once it has found the step's pairs
+	bool IsMoved(const unsigned int Index) const { return (MovedMask[Index >> 5] & (1u << (Index & 31))) != 0; }
+	void SetMoved(const unsigned int Index, const bool State) { SetBit(MovedMask, Index, State); }
+	void ClearMoved();
+
+	// Kinematic bodies and planes, the solver never moves them
+	bool IsStatic(const unsigned int Index) const { return Index >= DynamicCount; }
+
+	// Awake and free to move, a pair needs at least one of these to be worth testing
+	bool IsActive(const unsigned int Index) const { return IsAwake(Index) && !IsStatic(Index); }
+
+	std::vector<Object*> Owners;
+
+	std::vector<float> PositionX, PositionY;
+	std::vector<float> VelocityX, VelocityY;
+	std::vector<float> RotationCos, RotationSin; // Unit rotor, see Object::GetRotor
+	std::vector<float> AngularVelocity;
+	std::vector<float> Mass, InverseMass, InverseMoment;
+	std::vector<float> LinearDrag, AngularDrag, Friction;
+
+	// Zero for anything that isn't a circle
+	std::vector<float> Radius;
+
+	// How long each body has been moving slowly enough to sleep
+	std::vector<float> SleepTime;
+
+	// One bit per body
+	std::vector<unsigned int> KinematicMask;
+	std::vector<unsigned int> AwakeMask;
+	std::vector<unsigned int> BulletMask;
+	std::vector<unsigned int> MovedMask;
+
+private:
+	unsigned int DynamicCount{};
+
+	// Handles point at a slot and the slot points at wherever its body is now, only swaps and removals touch these
+	std::vector<unsigned int> SlotIndex;
+	std::vector<unsigned int> Generations;
+	std::vector<unsigned int> FreeSlots;
+	std::vector<unsigned int> BodySlot;
+
+	// Exchanges every value of two bodies and tells their owners
+	void Swap(unsigned int A, unsigned int B);
+
+	static void SetBit(std::vector<unsigned int>& Mask, unsigned int Index, bool State);
+};
+
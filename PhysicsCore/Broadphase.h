@@ -0,0 +1,62 @@
+#pragma once
+#include "Object.h"
+
+#include <vector>
+
+enum BroadphaseMethod
+{
+	BRUTE_FORCE, UNIFORM_GRID, SWEEP_AND_PRUNE, DYNAMIC_TREE
+};
+
+struct CollisionPair
+{
+	Object* A;
+	Object* B;
+};
+
+// Finds the pairs of actors that could be touching, so the narrowphase only runs on those
+class Broadphase
+{
+public:
+	virtual ~Broadphase() = default;
+
+	// Persistent broadphases track actors between steps, the others rebuild from the actor list every step
+	virtual void AddActor(Object*) {}
+	virtual void RemoveActor(Object*) {}
+
+	// Lets a broadphase tidy up once for the whole batch instead of once per actor
+	virtual void RemoveActors(const std::vector<Object*>& Actors)
+	{
+		for (Object* Actor : Actors)
+			RemoveActor(Actor);
+	}
+
+	// Actors [0, DynamicCount) can move, the rest are kinematic or planes and are never paired with each other
+	virtual void FindPairs(const std::vector<Object*>& Actors, unsigned int DynamicCount, std::vector<CollisionPair>& OutPairs) = 0;
+
+	static bool Overlaps(const Bounds& A, const Bounds& B)
+	{
+		return A.Min.x <= B.Max.x && B.Min.x <= A.Max.x && A.Min.y <= B.Max.y && B.Min.y <= A.Max.y;
+	}
+
+	// Awake and free to move. Sleeping and static actors can't push each other, so every pair needs one of these
+	static bool IsActive(const Object* Actor) { return Actor->IsAwake() && !Actor->IsStatic(); }
+
+	// Sleeping and static actors stay put until SetLocation moves them, so bounds read while an actor was resting
+	// can be kept for as long as it stays that way
+	static bool IsResting(const Object* Actor) { return !Actor->IsAwake() || Actor->IsStatic(); }
+	static bool IsStillResting(const Object* Actor, const bool bWasResting) { return bWasResting && IsResting(Actor) && !Actor->IsMoved(); }
+
+	// Read every step, so filters can be changed at any time without touching the broadphase
+	static bool ShouldCollide(const Object* A, const Object* B)
+	{
+		const CollisionFilter& FilterA = A->GetCollisionFilter();
+		const CollisionFilter& FilterB = B->GetCollisionFilter();
+
+		if (FilterA.Group != 0 && FilterA.Group == FilterB.Group)
+			return FilterA.Group > 0;
+
+		return (FilterA.Category & FilterB.Mask) != 0 && (FilterB.Category & FilterA.Mask) != 0;
+	}
+};
+
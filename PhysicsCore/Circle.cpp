@@ -1,5 +1,4 @@
 #include "Circle.h"
-#include "Gizmos.h"
 #include <glm/ext.hpp>
 
 #include <stdio.h>
@@ -33,15 +32,11 @@ Circle::~Circle() = default;
 
 void Circle::Debug()
 {
-	printf("X: %f, Y: %f\n", Location.x, Location.y);
+	printf("X: %f, Y: %f\n", GetLocation().x, GetLocation().y);
 	printf("Radius: %f\n", Radius);
 }
 
-void Circle::MakeGizmo()
+Bounds Circle::GetBounds() const
 {
-	// Circle
-	aie::Gizmos::add2DCircle(Location, Radius, 30, Color);
-
-	const glm::vec2 End = glm::vec2(cosf(Rotation), sinf(Rotation)) * Radius;
-	aie::Gizmos::add2DLine(Location, Location + End, { 1.0f, 1.0f, 1.0f, 1.0f });
+	return { GetLocation() - Radius, GetLocation() + Radius };
 }
@@ -10,7 +10,7 @@ public:
 	~Circle();
 
 	void Debug() override;
-	void MakeGizmo() override;
+	Bounds GetBounds() const override;
 
 	float GetRadius() const { return Radius; }
 
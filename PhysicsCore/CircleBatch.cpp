@@ -0,0 +1,143 @@
+#include "CircleBatch.h"
+
+#include <cmath>
+
+#if defined(_M_X64) || defined(_M_IX86) || defined(__x86_64__) || defined(__i386__)
+#define PHYSICS_X86 1
+#include <immintrin.h>
+#endif
+
+#if defined(__GNUC__)
+#define TARGET_AVX __attribute__((target("avx")))
+#else
+#define TARGET_AVX
+#endif
+
+void CircleBatch::Collide(const BodyStore& Bodies, const std::vector<unsigned int>& IndexA, const std::vector<unsigned int>& IndexB, std::vector<CircleContact>& OutContacts, const IntegratorPath Path)
+{
+	const unsigned int Count = IndexA.size();
+	unsigned int Done = 0;
+
+	if (Path == INTEGRATOR_AVX)
+		Done = CollideAVX(Bodies, IndexA.data(), IndexB.data(), 0, Count, OutContacts);
+
+	CollideScalar(Bodies, IndexA.data(), IndexB.data(), Done, Count, OutContacts);
+}
+
+// Same maths as World::CircleToCircle
+unsigned int CircleBatch::CollideScalar(const BodyStore& Bodies, const unsigned int* IndexA, const unsigned int* IndexB, const unsigned int First, const unsigned int Last, std::vector<CircleContact>& OutContacts)
+{
+	for (unsigned int i = First; i < Last; i++)
+	{
+		const unsigned int A = IndexA[i];
+		const unsigned int B = IndexB[i];
+
+		const float NormalX = Bodies.PositionX[B] - Bodies.PositionX[A];
+		const float NormalY = Bodies.PositionY[B] - Bodies.PositionY[A];
+
+		const float DistanceSquared = NormalX * NormalX + NormalY * NormalY;
+
+		const float RadiiSum = Bodies.Radius[A] + Bodies.Radius[B];
+
+		if (DistanceSquared > RadiiSum * RadiiSum)
+			continue;
+
+		const float Length = sqrtf(DistanceSquared);
+
+		CircleContact Contact;
+		Contact.Penetration = RadiiSum - Length;
+		Contact.Pair = i;
+
+		// Circles sitting exactly on top of each other have no direction, push them apart vertically
+		if (DistanceSquared > 0.0f)
+		{
+			const float InverseLength = 1.0f / Length;
+			Contact.Normal = { NormalX * InverseLength, NormalY * InverseLength };
+		}
+		else
+			Contact.Normal = { 0.0f, 1.0f };
+
+		OutContacts.push_back(Contact);
+	}
+
+	return Last;
+}
+
+#if defined(PHYSICS_X86)
+
+TARGET_AVX unsigned int CircleBatch::CollideAVX(const BodyStore& Bodies, const unsigned int* IndexA, const unsigned int* IndexB, const unsigned int First, const unsigned int Last, std::vector<CircleContact>& OutContacts)
+{
+	const float* PositionX = Bodies.PositionX.data();
+	const float* PositionY = Bodies.PositionY.data();
+	const float* Radius = Bodies.Radius.data();
+
+	const __m256 Zero = _mm256_setzero_ps();
+	const __m256 One = _mm256_set1_ps(1.0f);
+
+	unsigned int i = First;
+
+	for (; i + 8 <= Last; i += 8)
+	{
+		const unsigned int* A = IndexA + i;
+		const unsigned int* B = IndexB + i;
+
+		// AVX has no gather, the pairs point all over the store anyway
+		const __m256 AX = _mm256_setr_ps(PositionX[A[0]], PositionX[A[1]], PositionX[A[2]], PositionX[A[3]], PositionX[A[4]], PositionX[A[5]], PositionX[A[6]], PositionX[A[7]]);
+		const __m256 AY = _mm256_setr_ps(PositionY[A[0]], PositionY[A[1]], PositionY[A[2]], PositionY[A[3]], PositionY[A[4]], PositionY[A[5]], PositionY[A[6]], PositionY[A[7]]);
+		const __m256 AR = _mm256_setr_ps(Radius[A[0]], Radius[A[1]], Radius[A[2]], Radius[A[3]], Radius[A[4]], Radius[A[5]], Radius[A[6]], Radius[A[7]]);
+		const __m256 BX = _mm256_setr_ps(PositionX[B[0]], PositionX[B[1]], PositionX[B[2]], PositionX[B[3]], PositionX[B[4]], PositionX[B[5]], PositionX[B[6]], PositionX[B[7]]);
+		const __m256 BY = _mm256_setr_ps(PositionY[B[0]], PositionY[B[1]], PositionY[B[2]], PositionY[B[3]], PositionY[B[4]], PositionY[B[5]], PositionY[B[6]], PositionY[B[7]]);
+		const __m256 BR = _mm256_setr_ps(Radius[B[0]], Radius[B[1]], Radius[B[2]], Radius[B[3]], Radius[B[4]], Radius[B[5]], Radius[B[6]], Radius[B[7]]);
+
+		const __m256 NormalX = _mm256_sub_ps(BX, AX);
+		const __m256 NormalY = _mm256_sub_ps(BY, AY);
+
+		const __m256 DistanceSquared = _mm256_add_ps(_mm256_mul_ps(NormalX, NormalX), _mm256_mul_ps(NormalY, NormalY));
+
+		const __m256 RadiiSum = _mm256_add_ps(AR, BR);
+
+		// Not greater rather than less or equal, so NaN positions are treated the same as the scalar loop
+		const int Touching = _mm256_movemask_ps(_mm256_cmp_ps(DistanceSquared, _mm256_mul_ps(RadiiSum, RadiiSum), _CMP_NGT_UQ));
+
+		if (Touching == 0)
+			continue;
+
+		const __m256 Length = _mm256_sqrt_ps(DistanceSquared);
+
+		// Coincident lanes get a zero length here and are patched below, the same as the scalar loop
+		const __m256 Apart = _mm256_cmp_ps(DistanceSquared, Zero, _CMP_GT_OQ);
+		const __m256 InverseLength = _mm256_and_ps(Apart, _mm256_div_ps(One, Length));
+
+		alignas(32) float OutNormalX[8];
+		alignas(32) float OutNormalY[8];
+		alignas(32) float OutPenetration[8];
+
+		_mm256_store_ps(OutNormalX, _mm256_mul_ps(NormalX, InverseLength));
+		_mm256_store_ps(OutNormalY, _mm256_blendv_ps(One, _mm256_mul_ps(NormalY, InverseLength), Apart));
+		_mm256_store_ps(OutPenetration, _mm256_sub_ps(RadiiSum, Length));
+
+		for (unsigned int Lane = 0; Lane < 8; Lane++)
+		{
+			if ((Touching & (1 << Lane)) == 0)
+				continue;
+
+			CircleContact Contact;
+			Contact.Normal = { OutNormalX[Lane], OutNormalY[Lane] };
+			Contact.Penetration = OutPenetration[Lane];
+			Contact.Pair = i + Lane;
+
+			OutContacts.push_back(Contact);
+		}
+	}
+
+	return i;
+}
+
+#else
+
+unsigned int CircleBatch::CollideAVX(const BodyStore&, const unsigned int*, const unsigned int*, const unsigned int First, unsigned int, std::vector<CircleContact>&)
+{
+	return First;
+}
+
+#endif
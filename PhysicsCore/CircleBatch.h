@@ -0,0 +1,30 @@
+#pragma once
+#include "BodyStore.h"
+#include "Integrator.h"
+
+#include <glm/vec2.hpp>
+
+#include <vector>
+
+// One touching circle pair, Normal points from A to B
+struct CircleContact
+{
+	glm::vec2 Normal;
+	float Penetration;
+
+	// Index into the arrays handed to Collide
+	unsigned int Pair;
+};
+
+// Narrowphase for circle pairs, tested 8 at a time straight from the BodyStore arrays
+class CircleBatch
+{
+public:
+	// IndexA and IndexB hold the body indices of each candidate pair. Appends a record for every pair that touches, in pair order
+	static void Collide(const BodyStore& Bodies, const std::vector<unsigned int>& IndexA, const std::vector<unsigned int>& IndexB, std::vector<CircleContact>& OutContacts, IntegratorPath Path);
+
+private:
+	static unsigned int CollideScalar(const BodyStore& Bodies, const unsigned int* IndexA, const unsigned int* IndexB, unsigned int First, unsigned int Last, std::vector<CircleContact>& OutContacts);
+	static unsigned int CollideAVX(const BodyStore& Bodies, const unsigned int* IndexA, const unsigned int* IndexB, unsigned int First, unsigned int Last, std::vector<CircleContact>& OutContacts);
+};
+
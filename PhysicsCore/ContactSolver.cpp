@@ -0,0 +1,222 @@
+#include "ContactSolver.h"
+
+#include <glm/glm.hpp>
+#include <functional>
+#include <cmath>
+
+// Fraction of the penetration fed back into the velocity each step
+static const float BAUMGARTE = 0.2f;
+
+// Overlap left alone so resting contacts don't flicker between touching and not
+static const float PENETRATION_SLOP = 0.1f;
+
+// Fastest the solver may push shapes apart to fix penetration, deep overlaps would explode otherwise
+static const float MAX_CORRECTION_VELOCITY = 20.0f;
+
+// Closing speeds below this don't bounce, which lets stacks settle
+static const float RESTITUTION_THRESHOLD = 1.0f;
+
+ContactSolver::ContactSolver() = default;
+ContactSolver::~ContactSolver() = default;
+
+size_t ContactSolver::ContactKeyHash::operator()(const ContactKey& Key) const
+{
+	const size_t A = std::hash<unsigned int>()(Key.A.Slot) * 31 + Key.A.Generation;
+	const size_t B = std::hash<unsigned int>()(Key.B.Slot) * 31 + Key.B.Generation;
+
+	return A * 31 + B;
+}
+
+// 2D cross products, of two vectors and of an angular velocity with a vector
+static float Cross(const glm::vec2 A, const glm::vec2 B)
+{
+	return A.x * B.y - A.y * B.x;
+}
+
+static glm::vec2 Cross(const float W, const glm::vec2 V)
+{
+	return { -W * V.y, W * V.x };
+}
+
+void ContactSolver::Solve(const std::vector<Manifold>& Contacts, BodyStore& Bodies, const float TimeStep)
+{
+	Constraints.clear();
+	NextCache.clear();
+
+	// Prepare everything that stays the same across the iterations
+	for (const Manifold& M : Contacts)
+	{
+		Constraint C;
+		C.A = M.A->GetBodyIndex();
+		C.B = M.B->GetBodyIndex();
+
+		// Planes and kinematic bodies don't move, treat them as infinitely heavy
+		const bool bStaticA = M.A->GetShape() == PLANE || Bodies.IsKinematic(C.A);
+		const bool bStaticB = M.B->GetShape() == PLANE || Bodies.IsKinematic(C.B);
+
+		C.InverseMassA = bStaticA ? 0.0f : Bodies.InverseMass[C.A];
+		C.InverseMassB = bStaticB ? 0.0f : Bodies.InverseMass[C.B];
+		C.InverseMomentA = bStaticA ? 0.0f : Bodies.InverseMoment[C.A];
+		C.InverseMomentB = bStaticB ? 0.0f : Bodies.InverseMoment[C.B];
+
+		const float InverseMassSum = C.InverseMassA + C.InverseMassB;
+
+		if (InverseMassSum <= 0.0f || dot(M.Normal, M.Normal) <= 0.0f)
+			continue;
+
+		C.Normal = normalize(M.Normal);
+		C.Tangent = { -C.Normal.y, C.Normal.x };
+
+		// Against a plane only the body's own material counts
+		float Restitution;
+
+		if (bStaticA && M.A->GetShape() == PLANE)
+		{
+			Restitution = M.B->GetRestitution();
+			C.Friction = sqrtf(M.B->GetFriction());
+		}
+		else if (bStaticB && M.B->GetShape() == PLANE)
+		{
+			Restitution = M.A->GetRestitution();
+			C.Friction = sqrtf(M.A->GetFriction());
+		}
+		else
+		{
+			Restitution = glm::min(M.A->GetRestitution(), M.B->GetRestitution()) / 2.0f;
+			C.Friction = sqrtf(M.A->GetFriction() * M.B->GetFriction());
+		}
+
+		// Key the pair by handle so it is found again whichever way round the broadphase reports it
+		const BodyHandle HandleA = Bodies.GetHandle(C.A);
+		const BodyHandle HandleB = Bodies.GetHandle(C.B);
+		C.bKeySwapped = HandleB.Slot < HandleA.Slot;
+		C.Key = { C.bKeySwapped ? HandleB : HandleA, C.bKeySwapped ? HandleA : HandleB };
+
+		// A contact without located points pushes through both centres, so it never turns either body
+		const glm::vec2 CentreA = { Bodies.PositionX[C.A], Bodies.PositionY[C.A] };
+		const glm::vec2 CentreB = { Bodies.PositionX[C.B], Bodies.PositionY[C.B] };
+
+		C.PointCount = M.bHasPoints ? M.ContactsCount : 1;
+		C.bTurns = M.bHasPoints && C.InverseMomentA + C.InverseMomentB > 0.0f;
+		const auto Found = Cache.find(C.Key);
+		const bool bPersistent = Found != Cache.end();
+
+		const glm::vec2 RelativeVelocity = glm::vec2(Bodies.VelocityX[C.B], Bodies.VelocityY[C.B]) - glm::vec2(Bodies.VelocityX[C.A], Bodies.VelocityY[C.A]);
+		const float ClosingVelocity = dot(RelativeVelocity, C.Normal);
+
+		for (unsigned int i = 0; i < C.PointCount; i++)
+		{
+			ConstraintPoint& Point = C.Points[i];
+			Point.OffsetA = M.bHasPoints ? M.Points[i].Location - CentreA : glm::vec2(0.0f);
+			Point.OffsetB = M.bHasPoints ? M.Points[i].Location - CentreB : glm::vec2(0.0f);
+
+			const float Penetration = M.bHasPoints ? M.Points[i].Penetration : M.Penetration;
+			Point.Feature = M.bHasPoints ? M.Points[i].Feature : M.Feature;
+
+			// How hard the point is to move along each direction, once the bodies' turning is counted
+			const float NormalA = Cross(Point.OffsetA, C.Normal);
+			const float NormalB = Cross(Point.OffsetB, C.Normal);
+			const float TangentA = Cross(Point.OffsetA, C.Tangent);
+			const float TangentB = Cross(Point.OffsetB, C.Tangent);
+
+			Point.NormalMass = 1.0f / (InverseMassSum + C.InverseMomentA * NormalA * NormalA + C.InverseMomentB * NormalB * NormalB);
+			Point.TangentMass = 1.0f / (InverseMassSum + C.InverseMomentA * TangentA * TangentA + C.InverseMomentB * TangentB * TangentB);
+
+			// Only pairs that weren't touching at all last step bounce, going by how fast the centres close. Bouncing a
+			// resting contact on top of its warm start, or a box rocking from one corner onto the other, pumps energy into stacks
+			Point.Bias = !bPersistent && ClosingVelocity < -RESTITUTION_THRESHOLD ? -Restitution * ClosingVelocity : 0.0f;
+			Point.Bias += glm::min(BAUMGARTE / TimeStep * glm::max(Penetration - PENETRATION_SLOP, 0.0f), MAX_CORRECTION_VELOCITY);
+
+			Point.NormalImpulse = 0.0f;
+			Point.TangentImpulse = 0.0f;
+
+			if (!bWarmStarting || !bPersistent)
+				continue;
+
+			for (unsigned int j = 0; j < Found->second.Count; j++)
+			{
+				const CachedImpulse& Cached = Found->second.Points[j];
+
+				if (Cached.Feature != Point.Feature)
+					continue;
+
+				// Swapping A and B flips the normal and the tangent, the normal impulse doesn't care but the tangent one does
+				Point.NormalImpulse = Cached.Normal;
+				Point.TangentImpulse = C.bKeySwapped ? -Cached.Tangent : Cached.Tangent;
+
+				ApplyImpulse(Bodies, C, Point, C.Normal * Point.NormalImpulse + C.Tangent * Point.TangentImpulse);
+			}
+		}
+
+		Constraints.push_back(C);
+	}
+
+	for (int Iteration = 0; Iteration < Iterations; Iteration++)
+	{
+		for (Constraint& C : Constraints)
+		{
+			for (unsigned int i = 0; i < C.PointCount; i++)
+			{
+				ConstraintPoint& Point = C.Points[i];
+
+				// Friction first, bounded by the normal impulse from the last pass
+				glm::vec2 RelativeVelocity = GetRelativeVelocity(Bodies, C, Point);
+
+				const float MaxFriction = C.Friction * Point.NormalImpulse;
+				const float NewTangentImpulse = glm::clamp(Point.TangentImpulse - dot(RelativeVelocity, C.Tangent) * Point.TangentMass, -MaxFriction, MaxFriction);
+
+				ApplyImpulse(Bodies, C, Point, C.Tangent * (NewTangentImpulse - Point.TangentImpulse));
+				Point.TangentImpulse = NewTangentImpulse;
+
+				// Then the normal, the total may never pull the shapes together
+				RelativeVelocity = GetRelativeVelocity(Bodies, C, Point);
+
+				const float NewNormalImpulse = glm::max(Point.NormalImpulse - (dot(RelativeVelocity, C.Normal) - Point.Bias) * Point.NormalMass, 0.0f);
+
+				ApplyImpulse(Bodies, C, Point, C.Normal * (NewNormalImpulse - Point.NormalImpulse));
+				Point.NormalImpulse = NewNormalImpulse;
+			}
+		}
+	}
+
+	for (const Constraint& C : Constraints)
+	{
+		CachedPair& Pair = NextCache[C.Key];
+		Pair.Count = C.PointCount;
+
+		for (unsigned int i = 0; i < C.PointCount; i++)
+		{
+			const ConstraintPoint& Point = C.Points[i];
+			Pair.Points[i] = { Point.Feature, Point.NormalImpulse, C.bKeySwapped ? -Point.TangentImpulse : Point.TangentImpulse };
+		}
+	}
+
+	// Pairs that stopped touching drop out here
+	Cache.swap(NextCache);
+}
+
+// Angular velocities are kept in degrees per second, the impulse maths wants radians
+glm::vec2 ContactSolver::GetRelativeVelocity(const BodyStore& Bodies, const Constraint& C, const ConstraintPoint& Point) const
+{
+	const glm::vec2 RelativeVelocity = glm::vec2(Bodies.VelocityX[C.B], Bodies.VelocityY[C.B]) - glm::vec2(Bodies.VelocityX[C.A], Bodies.VelocityY[C.A]);
+
+	if (!C.bTurns)
+		return RelativeVelocity;
+
+	return RelativeVelocity + Cross(DEG2RAD(Bodies.AngularVelocity[C.B]), Point.OffsetB) - Cross(DEG2RAD(Bodies.AngularVelocity[C.A]), Point.OffsetA);
+}
+
+void ContactSolver::ApplyImpulse(BodyStore& Bodies, const Constraint& C, const ConstraintPoint& Point, const glm::vec2 Impulse) const
+{
+	Bodies.VelocityX[C.A] -= Impulse.x * C.InverseMassA;
+	Bodies.VelocityY[C.A] -= Impulse.y * C.InverseMassA;
+
+	Bodies.VelocityX[C.B] += Impulse.x * C.InverseMassB;
+	Bodies.VelocityY[C.B] += Impulse.y * C.InverseMassB;
+
+	if (C.bTurns)
+	{
+		Bodies.AngularVelocity[C.A] -= RAD2DEG(Cross(Point.OffsetA, Impulse) * C.InverseMomentA);
+		Bodies.AngularVelocity[C.B] += RAD2DEG(Cross(Point.OffsetB, Impulse) * C.InverseMomentB);
+	}
+}
@@ -0,0 +1,108 @@
+#pragma once
+#include "Manifold.h"
+#include "BodyStore.h"
+
+#include <unordered_map>
+#include <vector>
+
+// Sequential impulse solver. Every contact point is solved a few times over, clamping the total impulse each one
+// has applied rather than each individual push, and the totals are carried over to the next step for the same pair.
+// Points the narrowphase located push off where they touch, so they turn the bodies as well as moving them
+class ContactSolver
+{
+public:
+	ContactSolver();
+	~ContactSolver();
+
+	// Changes velocities in Bodies so the contacts stop closing, positions are left to the next integration
+	void Solve(const std::vector<Manifold>& Contacts, BodyStore& Bodies, float TimeStep);
+
+	void SetIterations(const int Iterations) { this->Iterations = Iterations > 0 ? Iterations : 1; }
+	int GetIterations() const { return Iterations; }
+
+	void SetWarmStarting(const bool State) { bWarmStarting = State; }
+	bool IsWarmStarting() const { return bWarmStarting; }
+
+private:
+	// Identifies a pair from one step to the next, A is always the lower slot. Handles rather than addresses,
+	// so a pooled object reusing a removed one's memory never picks up the impulse that was left behind
+	struct ContactKey
+	{
+		BodyHandle A;
+		BodyHandle B;
+
+		bool operator==(const ContactKey& Other) const { return A == Other.A && B == Other.B; }
+	};
+
+	struct ContactKeyHash
+	{
+		size_t operator()(const ContactKey& Key) const;
+	};
+
+	struct CachedImpulse
+	{
+		unsigned int Feature;
+		float Normal;
+		float Tangent;
+	};
+
+	// What a pair's points applied last step, matched up with this step's points by feature
+	struct CachedPair
+	{
+		CachedImpulse Points[MAX_CONTACT_POINTS];
+		unsigned int Count;
+	};
+
+	// One point of a contact, with the offsets from each body's centre its impulses turn the bodies through
+	struct ConstraintPoint
+	{
+		glm::vec2 OffsetA, OffsetB;
+
+		float NormalMass;
+		float TangentMass;
+
+		// Target closing speed, bounce plus penetration recovery
+		float Bias;
+
+		float NormalImpulse;
+		float TangentImpulse;
+
+		unsigned int Feature;
+	};
+
+	// A contact ready for solving, in body indices and plain floats. Its points share the normal and are solved together
+	struct Constraint
+	{
+		unsigned int A, B;
+		float InverseMassA, InverseMassB;
+		float InverseMomentA, InverseMomentB;
+
+		glm::vec2 Normal;
+		glm::vec2 Tangent;
+
+		float Friction;
+
+		ConstraintPoint Points[MAX_CONTACT_POINTS];
+		unsigned int PointCount;
+
+		// Whether the points push off-centre on anything that can turn, the rest skip the angular terms
+		bool bTurns;
+
+		ContactKey Key;
+		bool bKeySwapped;
+	};
+
+	// Velocity of B relative to A where the point is
+	glm::vec2 GetRelativeVelocity(const BodyStore& Bodies, const Constraint& C, const ConstraintPoint& Point) const;
+
+	void ApplyImpulse(BodyStore& Bodies, const Constraint& C, const ConstraintPoint& Point, glm::vec2 Impulse) const;
+
+	int Iterations{8};
+	bool bWarmStarting{true};
+
+	std::vector<Constraint> Constraints;
+
+	std::unordered_map<ContactKey, CachedPair, ContactKeyHash> Cache;
+	std::unordered_map<ContactKey, CachedPair, ContactKeyHash> NextCache;
+};
+
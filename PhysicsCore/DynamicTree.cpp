@@ -0,0 +1,331 @@
+#include "DynamicTree.h"
+
+#include <glm/ext.hpp>
+
+static Bounds Union(const Bounds& A, const Bounds& B)
+{
+	return { glm::min(A.Min, B.Min), glm::max(A.Max, B.Max) };
+}
+
+static float Perimeter(const Bounds& Box)
+{
+	return 2.0f * ((Box.Max.x - Box.Min.x) + (Box.Max.y - Box.Min.y));
+}
+
+static bool Contains(const Bounds& Outer, const Bounds& Inner)
+{
+	return Outer.Min.x <= Inner.Min.x && Outer.Min.y <= Inner.Min.y && Inner.Max.x <= Outer.Max.x && Inner.Max.y <= Outer.Max.y;
+}
+
+DynamicTree::DynamicTree() = default;
+DynamicTree::~DynamicTree() = default;
+
+int DynamicTree::CreateProxy(const Bounds& Box, const int UserData)
+{
+	const int Proxy = AllocateNode();
+
+	Nodes[Proxy].Box = { Box.Min - Margin, Box.Max + Margin };
+	Nodes[Proxy].UserData = UserData;
+	Nodes[Proxy].Height = 0;
+
+	InsertLeaf(Proxy);
+
+	return Proxy;
+}
+
+void DynamicTree::DestroyProxy(const int Proxy)
+{
+	RemoveLeaf(Proxy);
+	FreeNode(Proxy);
+}
+
+bool DynamicTree::MoveProxy(const int Proxy, const Bounds& Box)
+{
+	if (Contains(Nodes[Proxy].Box, Box))
+		return false;
+
+	RemoveLeaf(Proxy);
+
+	Nodes[Proxy].Box = { Box.Min - Margin, Box.Max + Margin };
+
+	InsertLeaf(Proxy);
+
+	return true;
+}
+
+int DynamicTree::AllocateNode()
+{
+	if (FreeList == NULL_NODE)
+	{
+		FreeList = Nodes.size();
+		Nodes.push_back({ {}, NULL_NODE, NULL_NODE, NULL_NODE, -1, -1 });
+	}
+
+	const int Index = FreeList;
+	FreeList = Nodes[Index].Parent;
+
+	Nodes[Index].Parent = NULL_NODE;
+	Nodes[Index].Child1 = NULL_NODE;
+	Nodes[Index].Child2 = NULL_NODE;
+	Nodes[Index].Height = 0;
+	Nodes[Index].UserData = -1;
+
+	return Index;
+}
+
+void DynamicTree::FreeNode(const int Index)
+{
+	Nodes[Index].Parent = FreeList;
+	Nodes[Index].Height = -1;
+	FreeList = Index;
+}
+
+void DynamicTree::InsertLeaf(const int Leaf)
+{
+	if (Root == NULL_NODE)
+	{
+		Root = Leaf;
+		Nodes[Root].Parent = NULL_NODE;
+		return;
+	}
+
+	// Walk down to the sibling that makes the tree grow the least
+	const Bounds LeafBox = Nodes[Leaf].Box;
+	int Index = Root;
+
+	while (!Nodes[Index].IsLeaf())
+	{
+		const int Child1 = Nodes[Index].Child1;
+		const int Child2 = Nodes[Index].Child2;
+
+		const float Area = Perimeter(Nodes[Index].Box);
+		const float CombinedArea = Perimeter(Union(Nodes[Index].Box, LeafBox));
+
+		// Cost of pairing the leaf with this node
+		const float Cost = 2.0f * CombinedArea;
+
+		// Minimum cost pushed down to the children
+		const float InheritanceCost = 2.0f * (CombinedArea - Area);
+
+		float Cost1 = Perimeter(Union(LeafBox, Nodes[Child1].Box)) + InheritanceCost;
+		if (!Nodes[Child1].IsLeaf())
+			Cost1 -= Perimeter(Nodes[Child1].Box);
+
+		float Cost2 = Perimeter(Union(LeafBox, Nodes[Child2].Box)) + InheritanceCost;
+		if (!Nodes[Child2].IsLeaf())
+			Cost2 -= Perimeter(Nodes[Child2].Box);
+
+		if (Cost < Cost1 && Cost < Cost2)
+			break;
+
+		Index = Cost1 < Cost2 ? Child1 : Child2;
+	}
+
+	const int Sibling = Index;
+
+	// Give the leaf and its sibling a new parent
+	const int OldParent = Nodes[Sibling].Parent;
+	const int NewParent = AllocateNode();
+
+	Nodes[NewParent].Parent = OldParent;
+	Nodes[NewParent].Box = Union(LeafBox, Nodes[Sibling].Box);
+	Nodes[NewParent].Height = Nodes[Sibling].Height + 1;
+	Nodes[NewParent].Child1 = Sibling;
+	Nodes[NewParent].Child2 = Leaf;
+
+	if (OldParent != NULL_NODE)
+	{
+		if (Nodes[OldParent].Child1 == Sibling)
+			Nodes[OldParent].Child1 = NewParent;
+		else
+			Nodes[OldParent].Child2 = NewParent;
+	}
+	else
+	{
+		Root = NewParent;
+	}
+
+	Nodes[Sibling].Parent = NewParent;
+	Nodes[Leaf].Parent = NewParent;
+
+	Refit(NewParent);
+}
+
+void DynamicTree::RemoveLeaf(const int Leaf)
+{
+	if (Leaf == Root)
+	{
+		Root = NULL_NODE;
+		return;
+	}
+
+	const int Parent = Nodes[Leaf].Parent;
+	const int GrandParent = Nodes[Parent].Parent;
+	const int Sibling = Nodes[Parent].Child1 == Leaf ? Nodes[Parent].Child2 : Nodes[Parent].Child1;
+
+	// The sibling takes the place of the parent
+	if (GrandParent != NULL_NODE)
+	{
+		if (Nodes[GrandParent].Child1 == Parent)
+			Nodes[GrandParent].Child1 = Sibling;
+		else
+			Nodes[GrandParent].Child2 = Sibling;
+
+		Nodes[Sibling].Parent = GrandParent;
+		FreeNode(Parent);
+
+		Refit(GrandParent);
+	}
+	else
+	{
+		Root = Sibling;
+		Nodes[Sibling].Parent = NULL_NODE;
+		FreeNode(Parent);
+	}
+}
+
+void DynamicTree::Refit(int Index)
+{
+	// Rebalance and shrink every ancestor on the way back up
+	while (Index != NULL_NODE)
+	{
+		Index = Balance(Index);
+
+		Node& Current = Nodes[Index];
+		const Node& Child1 = Nodes[Current.Child1];
+		const Node& Child2 = Nodes[Current.Child2];
+
+		Current.Height = 1 + glm::max(Child1.Height, Child2.Height);
+		Current.Box = Union(Child1.Box, Child2.Box);
+
+		Index = Current.Parent;
+	}
+}
+
+int DynamicTree::Balance(const int IndexA)
+{
+	Node& A = Nodes[IndexA];
+
+	if (A.IsLeaf() || A.Height < 2)
+		return IndexA;
+
+	const int IndexB = A.Child1;
+	const int IndexC = A.Child2;
+
+	Node& B = Nodes[IndexB];
+	Node& C = Nodes[IndexC];
+
+	const int Difference = C.Height - B.Height;
+
+	// Rotate C up
+	if (Difference > 1)
+	{
+		const int IndexF = C.Child1;
+		const int IndexG = C.Child2;
+
+		Node& F = Nodes[IndexF];
+		Node& G = Nodes[IndexG];
+
+		// Swap A and C
+		C.Child1 = IndexA;
+		C.Parent = A.Parent;
+		A.Parent = IndexC;
+
+		if (C.Parent != NULL_NODE)
+		{
+			if (Nodes[C.Parent].Child1 == IndexA)
+				Nodes[C.Parent].Child1 = IndexC;
+			else
+				Nodes[C.Parent].Child2 = IndexC;
+		}
+		else
+		{
+			Root = IndexC;
+		}
+
+		// The taller grandchild stays under C
+		if (F.Height > G.Height)
+		{
+			C.Child2 = IndexF;
+			A.Child2 = IndexG;
+			G.Parent = IndexA;
+
+			A.Box = Union(B.Box, G.Box);
+			C.Box = Union(A.Box, F.Box);
+
+			A.Height = 1 + glm::max(B.Height, G.Height);
+			C.Height = 1 + glm::max(A.Height, F.Height);
+		}
+		else
+		{
+			C.Child2 = IndexG;
+			A.Child2 = IndexF;
+			F.Parent = IndexA;
+
+			A.Box = Union(B.Box, F.Box);
+			C.Box = Union(A.Box, G.Box);
+
+			A.Height = 1 + glm::max(B.Height, F.Height);
+			C.Height = 1 + glm::max(A.Height, G.Height);
+		}
+
+		return IndexC;
+	}
+
+	// Rotate B up
+	if (Difference < -1)
+	{
+		const int IndexD = B.Child1;
+		const int IndexE = B.Child2;
+
+		Node& D = Nodes[IndexD];
+		Node& E = Nodes[IndexE];
+
+		// Swap A and B
+		B.Child1 = IndexA;
+		B.Parent = A.Parent;
+		A.Parent = IndexB;
+
+		if (B.Parent != NULL_NODE)
+		{
+			if (Nodes[B.Parent].Child1 == IndexA)
+				Nodes[B.Parent].Child1 = IndexB;
+			else
+				Nodes[B.Parent].Child2 = IndexB;
+		}
+		else
+		{
+			Root = IndexB;
+		}
+
+		// The taller grandchild stays under B
+		if (D.Height > E.Height)
+		{
+			B.Child2 = IndexD;
+			A.Child1 = IndexE;
+			E.Parent = IndexA;
+
+			A.Box = Union(C.Box, E.Box);
+			B.Box = Union(A.Box, D.Box);
+
+			A.Height = 1 + glm::max(C.Height, E.Height);
+			B.Height = 1 + glm::max(A.Height, D.Height);
+		}
+		else
+		{
+			B.Child2 = IndexE;
+			A.Child1 = IndexD;
+			D.Parent = IndexA;
+
+			A.Box = Union(C.Box, D.Box);
+			B.Box = Union(A.Box, E.Box);
+
+			A.Height = 1 + glm::max(C.Height, D.Height);
+			B.Height = 1 + glm::max(A.Height, E.Height);
+		}
+
+		return IndexB;
+	}
+
+	return IndexA;
+}
@@ -0,0 +1,109 @@
+#pragma once
+#include "Object.h"
+
+#include <vector>
+
+// A bounding volume hierarchy of fattened bounds. Leaves only get reinserted once their actor leaves its fat bounds,
+// and the tree is kept balanced with rotations as leaves come and go
+class DynamicTree
+{
+public:
+	DynamicTree();
+	~DynamicTree();
+
+	int CreateProxy(const Bounds& Box, int UserData);
+	void DestroyProxy(int Proxy);
+
+	// Returns true if the proxy had to be reinserted
+	bool MoveProxy(int Proxy, const Bounds& Box);
+
+	const Bounds& GetFatBounds(int Proxy) const { return Nodes[Proxy].Box; }
+	int GetUserData(int Proxy) const { return Nodes[Proxy].UserData; }
+
+	int GetHeight() const { return Root == NULL_NODE ? 0 : Nodes[Root].Height; }
+
+	// How far the stored bounds stick out past the actor's real bounds
+	void SetMargin(const float Margin) { this->Margin = Margin; }
+	float GetMargin() const { return Margin; }
+
+	// Calls Callback(UserData) for every proxy whose fat bounds overlap Box. Returning false from the callback stops the query
+	template <typename Fn>
+	void Query(const Bounds& Box, Fn&& Callback) const;
+
+	static const int NULL_NODE = -1;
+
+private:
+	struct Node
+	{
+		Bounds Box;
+
+		int Parent; // Next free node while the node is unused
+		int Child1, Child2;
+
+		int Height; // 0 for leaves, -1 for unused nodes
+		int UserData;
+
+		bool IsLeaf() const { return Child1 == NULL_NODE; }
+	};
+
+	std::vector<Node> Nodes;
+	int Root{NULL_NODE};
+	int FreeList{NULL_NODE};
+
+	float Margin{2.0f};
+
+	int AllocateNode();
+	void FreeNode(int Index);
+
+	void InsertLeaf(int Leaf);
+	void RemoveLeaf(int Leaf);
+	void Refit(int Index);
+
+	int Balance(int IndexA);
+};
+
+template <typename Fn>
+void DynamicTree::Query(const Bounds& Box, Fn&& Callback) const
+{
+	if (Root == NULL_NODE)
+		return;
+
+	// The tree stays balanced, so this is almost always deep enough. If it isn't, the stack moves to the heap
+	int FixedStack[256];
+	std::vector<int> GrownStack;
+	int* Stack = FixedStack;
+	int Capacity = 256;
+	int Count = 0;
+	Stack[Count++] = Root;
+
+	while (Count > 0)
+	{
+		const Node& Current = Nodes[Stack[--Count]];
+
+		if (Current.Box.Min.x > Box.Max.x || Box.Min.x > Current.Box.Max.x ||
+			Current.Box.Min.y > Box.Max.y || Box.Min.y > Current.Box.Max.y)
+			continue;
+
+		if (Current.IsLeaf())
+		{
+			if (!Callback(Current.UserData))
+				return;
+		}
+		else
+		{
+			if (Count + 2 > Capacity)
+			{
+				if (GrownStack.empty())
+					GrownStack.assign(FixedStack, FixedStack + Count);
+
+				Capacity *= 2;
+				GrownStack.resize(Capacity);
+				Stack = GrownStack.data();
+			}
+
+			Stack[Count++] = Current.Child1;
+			Stack[Count++] = Current.Child2;
+		}
+	}
+}
+
@@ -0,0 +1,312 @@
+#include "Integrator.h"
+#include "Object.h"
+
+#include <cmath>
+
+#if defined(_M_X64) || defined(_M_IX86) || defined(__x86_64__) || defined(__i386__)
+#define PHYSICS_X86 1
+#include <immintrin.h>
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+#endif
+
+// GCC and Clang only emit instructions the target allows, MSVC accepts any intrinsic
+#if defined(__GNUC__)
+#define TARGET_SSE2 __attribute__((target("sse2")))
+#define TARGET_AVX __attribute__((target("avx")))
+#else
+#define TARGET_SSE2
+#define TARGET_AVX
+#endif
+
+void Integrator::Integrate(BodyStore& Bodies, const glm::vec2 Gravity, const float TimeStep, const IntegratorPath Path)
+{
+	// Kinematic bodies and planes sit after the dynamic range and are never touched
+	const unsigned int Count = Bodies.GetDynamicCount();
+	unsigned int Done = 0;
+
+	// Blocks start on a multiple of 32 so every block sits inside a single word of the awake mask
+	if (Path == INTEGRATOR_AVX)
+		Done = IntegrateAVX(Bodies, Gravity, TimeStep, 0, Count);
+	else if (Path == INTEGRATOR_SSE)
+		Done = IntegrateSSE(Bodies, Gravity, TimeStep, 0, Count);
+
+	IntegrateScalar(Bodies, Gravity, TimeStep, Done, Count);
+}
+
+IntegratorPath Integrator::DetectPath()
+{
+#if defined(PHYSICS_X86)
+#if defined(_MSC_VER)
+	int Info[4];
+	__cpuid(Info, 1);
+
+	const bool bHasSSE2 = (Info[3] & (1 << 26)) != 0;
+
+	// AVX also needs the OS to save the upper halves of the registers
+	const bool bHasAVX = (Info[2] & (1 << 28)) != 0 && (Info[2] & (1 << 27)) != 0 && (_xgetbv(0) & 6) == 6;
+#else
+	__builtin_cpu_init();
+
+	const bool bHasSSE2 = __builtin_cpu_supports("sse2");
+	const bool bHasAVX = __builtin_cpu_supports("avx");
+#endif
+
+	if (bHasAVX)
+		return INTEGRATOR_AVX;
+
+	if (bHasSSE2)
+		return INTEGRATOR_SSE;
+#endif
+
+	return INTEGRATOR_SCALAR;
+}
+
+unsigned int Integrator::IntegrateScalar(BodyStore& Bodies, const glm::vec2 Gravity, const float TimeStep, const unsigned int First, const unsigned int Last)
+{
+	const float LinearThresholdSquared = MIN_LINEAR_THRESHOLD * MIN_LINEAR_THRESHOLD;
+
+	for (unsigned int i = First; i < Last; i++)
+	{
+		if (!Bodies.IsAwake(i))
+			continue;
+
+		// Gravity
+		const float ForceX = Gravity.x * Bodies.Mass[i] * TimeStep;
+		const float ForceY = Gravity.y * Bodies.Mass[i] * TimeStep;
+
+		Bodies.VelocityX[i] += ForceX * Bodies.InverseMass[i];
+		Bodies.VelocityY[i] += ForceY * Bodies.InverseMass[i];
+
+		Bodies.PositionX[i] += Bodies.VelocityX[i] * TimeStep;
+		Bodies.PositionY[i] += Bodies.VelocityY[i] * TimeStep;
+
+		const float Damping = Bodies.Friction[i] * Bodies.LinearDrag[i] * TimeStep;
+		Bodies.VelocityX[i] -= Bodies.VelocityX[i] * Damping;
+		Bodies.VelocityY[i] -= Bodies.VelocityY[i] * Damping;
+
+		// Turns the rotor by this step's angle to first order and renormalises, which keeps trig out of the loop.
+		// Steps turn far less than a radian, where that is as good as rotating by the exact angle
+		const float Turn = DEG2RAD(Bodies.AngularVelocity[i]) * TimeStep;
+
+		if (Turn != 0.0f)
+		{
+			const float TurnCos = Bodies.RotationCos[i] - Bodies.RotationSin[i] * Turn;
+			const float TurnSin = Bodies.RotationSin[i] + Bodies.RotationCos[i] * Turn;
+			const float InverseLength = 1.0f / sqrtf(TurnCos * TurnCos + TurnSin * TurnSin);
+
+			Bodies.RotationCos[i] = TurnCos * InverseLength;
+			Bodies.RotationSin[i] = TurnSin * InverseLength;
+		}
+
+		Bodies.AngularVelocity[i] -= Bodies.AngularVelocity[i] * Bodies.AngularDrag[i] * TimeStep;
+
+		if (Bodies.VelocityX[i] * Bodies.VelocityX[i] + Bodies.VelocityY[i] * Bodies.VelocityY[i] < LinearThresholdSquared)
+		{
+			Bodies.VelocityX[i] = 0.0f;
+			Bodies.VelocityY[i] = 0.0f;
+		}
+
+		if (fabsf(Bodies.AngularVelocity[i]) < MIN_ROTATION_THRESHOLD)
+			Bodies.AngularVelocity[i] = 0.0f;
+	}
+
+	return Last;
+}
+
+#if defined(PHYSICS_X86)
+
+// Lanes whose bit is set in Bits come out as all ones
+TARGET_SSE2 static __m128 ExpandMask(const unsigned int Bits)
+{
+	const __m128i Lanes = _mm_setr_epi32(1, 2, 4, 8);
+	return _mm_castsi128_ps(_mm_cmpeq_epi32(_mm_and_si128(_mm_set1_epi32(Bits), Lanes), Lanes));
+}
+
+// Mask ? A : B
+TARGET_SSE2 static __m128 Select(const __m128 Mask, const __m128 A, const __m128 B)
+{
+	return _mm_or_ps(_mm_and_ps(Mask, A), _mm_andnot_ps(Mask, B));
+}
+
+TARGET_SSE2 unsigned int Integrator::IntegrateSSE(BodyStore& Bodies, const glm::vec2 Gravity, const float TimeStep, const unsigned int First, const unsigned int Last)
+{
+	const __m128 GravityX = _mm_set1_ps(Gravity.x);
+	const __m128 GravityY = _mm_set1_ps(Gravity.y);
+	const __m128 Step = _mm_set1_ps(TimeStep);
+	const __m128 SignMask = _mm_set1_ps(-0.0f);
+	const __m128 LinearThresholdSquared = _mm_set1_ps(MIN_LINEAR_THRESHOLD * MIN_LINEAR_THRESHOLD);
+	const __m128 RotationThreshold = _mm_set1_ps(MIN_ROTATION_THRESHOLD);
+	const __m128 DegreesToRadians = _mm_set1_ps(DEG2RAD(1.0f));
+	const __m128 One = _mm_set1_ps(1.0f);
+	const __m128 Zero = _mm_setzero_ps();
+
+	unsigned int i = First;
+
+	for (; i + 4 <= Last; i += 4)
+	{
+		const unsigned int AwakeBits = (Bodies.AwakeMask[i >> 5] >> (i & 31)) & 0xF;
+
+		// A settled pile costs one test per block
+		if (AwakeBits == 0)
+			continue;
+
+		const __m128 Awake = ExpandMask(AwakeBits);
+
+		const __m128 PositionX = _mm_loadu_ps(&Bodies.PositionX[i]);
+		const __m128 PositionY = _mm_loadu_ps(&Bodies.PositionY[i]);
+		const __m128 RotationCos = _mm_loadu_ps(&Bodies.RotationCos[i]);
+		const __m128 RotationSin = _mm_loadu_ps(&Bodies.RotationSin[i]);
+		const __m128 OldVelocityX = _mm_loadu_ps(&Bodies.VelocityX[i]);
+		const __m128 OldVelocityY = _mm_loadu_ps(&Bodies.VelocityY[i]);
+		const __m128 OldAngularVelocity = _mm_loadu_ps(&Bodies.AngularVelocity[i]);
+
+		__m128 VelocityX = OldVelocityX;
+		__m128 VelocityY = OldVelocityY;
+		__m128 AngularVelocity = OldAngularVelocity;
+		const __m128 Mass = _mm_loadu_ps(&Bodies.Mass[i]);
+		const __m128 InverseMass = _mm_loadu_ps(&Bodies.InverseMass[i]);
+		const __m128 LinearDrag = _mm_loadu_ps(&Bodies.LinearDrag[i]);
+		const __m128 AngularDrag = _mm_loadu_ps(&Bodies.AngularDrag[i]);
+		const __m128 Friction = _mm_loadu_ps(&Bodies.Friction[i]);
+
+		// Gravity
+		const __m128 ForceX = _mm_mul_ps(_mm_mul_ps(GravityX, Mass), Step);
+		const __m128 ForceY = _mm_mul_ps(_mm_mul_ps(GravityY, Mass), Step);
+
+		VelocityX = _mm_add_ps(VelocityX, _mm_mul_ps(ForceX, InverseMass));
+		VelocityY = _mm_add_ps(VelocityY, _mm_mul_ps(ForceY, InverseMass));
+
+		const __m128 NewPositionX = _mm_add_ps(PositionX, _mm_mul_ps(VelocityX, Step));
+		const __m128 NewPositionY = _mm_add_ps(PositionY, _mm_mul_ps(VelocityY, Step));
+
+		const __m128 Damping = _mm_mul_ps(_mm_mul_ps(Friction, LinearDrag), Step);
+		VelocityX = _mm_sub_ps(VelocityX, _mm_mul_ps(VelocityX, Damping));
+		VelocityY = _mm_sub_ps(VelocityY, _mm_mul_ps(VelocityY, Damping));
+
+		const __m128 Turn = _mm_mul_ps(_mm_mul_ps(AngularVelocity, DegreesToRadians), Step);
+		const __m128 TurnCos = _mm_sub_ps(RotationCos, _mm_mul_ps(RotationSin, Turn));
+		const __m128 TurnSin = _mm_add_ps(RotationSin, _mm_mul_ps(RotationCos, Turn));
+		const __m128 InverseLength = _mm_div_ps(One, _mm_sqrt_ps(_mm_add_ps(_mm_mul_ps(TurnCos, TurnCos), _mm_mul_ps(TurnSin, TurnSin))));
+		const __m128 Turning = _mm_and_ps(Awake, _mm_cmpneq_ps(Turn, Zero));
+		AngularVelocity = _mm_sub_ps(AngularVelocity, _mm_mul_ps(_mm_mul_ps(AngularVelocity, AngularDrag), Step));
+
+		const __m128 SpeedSquared = _mm_add_ps(_mm_mul_ps(VelocityX, VelocityX), _mm_mul_ps(VelocityY, VelocityY));
+		const __m128 StopLinear = _mm_cmplt_ps(SpeedSquared, LinearThresholdSquared);
+		const __m128 StopAngular = _mm_cmplt_ps(_mm_andnot_ps(SignMask, AngularVelocity), RotationThreshold);
+
+		VelocityX = _mm_andnot_ps(StopLinear, VelocityX);
+		VelocityY = _mm_andnot_ps(StopLinear, VelocityY);
+		AngularVelocity = _mm_andnot_ps(StopAngular, AngularVelocity);
+
+		// Sleeping bodies are left exactly as they were, and so is the rotor of anything that isn't turning
+		_mm_storeu_ps(&Bodies.PositionX[i], Select(Awake, NewPositionX, PositionX));
+		_mm_storeu_ps(&Bodies.PositionY[i], Select(Awake, NewPositionY, PositionY));
+		_mm_storeu_ps(&Bodies.RotationCos[i], Select(Turning, _mm_mul_ps(TurnCos, InverseLength), RotationCos));
+		_mm_storeu_ps(&Bodies.RotationSin[i], Select(Turning, _mm_mul_ps(TurnSin, InverseLength), RotationSin));
+		_mm_storeu_ps(&Bodies.VelocityX[i], Select(Awake, VelocityX, OldVelocityX));
+		_mm_storeu_ps(&Bodies.VelocityY[i], Select(Awake, VelocityY, OldVelocityY));
+		_mm_storeu_ps(&Bodies.AngularVelocity[i], Select(Awake, AngularVelocity, OldAngularVelocity));
+	}
+
+	return i;
+}
+
+TARGET_AVX unsigned int Integrator::IntegrateAVX(BodyStore& Bodies, const glm::vec2 Gravity, const float TimeStep, const unsigned int First, const unsigned int Last)
+{
+	const __m256 GravityX = _mm256_set1_ps(Gravity.x);
+	const __m256 GravityY = _mm256_set1_ps(Gravity.y);
+	const __m256 Step = _mm256_set1_ps(TimeStep);
+	const __m256 SignMask = _mm256_set1_ps(-0.0f);
+	const __m256 LinearThresholdSquared = _mm256_set1_ps(MIN_LINEAR_THRESHOLD * MIN_LINEAR_THRESHOLD);
+	const __m256 RotationThreshold = _mm256_set1_ps(MIN_ROTATION_THRESHOLD);
+	const __m256 DegreesToRadians = _mm256_set1_ps(DEG2RAD(1.0f));
+	const __m256 One = _mm256_set1_ps(1.0f);
+	const __m256 Zero = _mm256_setzero_ps();
+
+	unsigned int i = First;
+
+	for (; i + 8 <= Last; i += 8)
+	{
+		const unsigned int AwakeBits = (Bodies.AwakeMask[i >> 5] >> (i & 31)) & 0xFF;
+
+		// A settled pile costs one test per block
+		if (AwakeBits == 0)
+			continue;
+
+		// AVX has no 256 bit integer compare, so expand the two halves of the mask separately
+		const __m256 Awake = _mm256_insertf128_ps(_mm256_castps128_ps256(ExpandMask(AwakeBits & 0xF)), ExpandMask(AwakeBits >> 4), 1);
+
+		const __m256 PositionX = _mm256_loadu_ps(&Bodies.PositionX[i]);
+		const __m256 PositionY = _mm256_loadu_ps(&Bodies.PositionY[i]);
+		const __m256 RotationCos = _mm256_loadu_ps(&Bodies.RotationCos[i]);
+		const __m256 RotationSin = _mm256_loadu_ps(&Bodies.RotationSin[i]);
+		const __m256 OldVelocityX = _mm256_loadu_ps(&Bodies.VelocityX[i]);
+		const __m256 OldVelocityY = _mm256_loadu_ps(&Bodies.VelocityY[i]);
+		const __m256 OldAngularVelocity = _mm256_loadu_ps(&Bodies.AngularVelocity[i]);
+
+		__m256 VelocityX = OldVelocityX;
+		__m256 VelocityY = OldVelocityY;
+		__m256 AngularVelocity = OldAngularVelocity;
+		const __m256 Mass = _mm256_loadu_ps(&Bodies.Mass[i]);
+		const __m256 InverseMass = _mm256_loadu_ps(&Bodies.InverseMass[i]);
+		const __m256 LinearDrag = _mm256_loadu_ps(&Bodies.LinearDrag[i]);
+		const __m256 AngularDrag = _mm256_loadu_ps(&Bodies.AngularDrag[i]);
+		const __m256 Friction = _mm256_loadu_ps(&Bodies.Friction[i]);
+
+		// Gravity
+		const __m256 ForceX = _mm256_mul_ps(_mm256_mul_ps(GravityX, Mass), Step);
+		const __m256 ForceY = _mm256_mul_ps(_mm256_mul_ps(GravityY, Mass), Step);
+
+		VelocityX = _mm256_add_ps(VelocityX, _mm256_mul_ps(ForceX, InverseMass));
+		VelocityY = _mm256_add_ps(VelocityY, _mm256_mul_ps(ForceY, InverseMass));
+
+		const __m256 NewPositionX = _mm256_add_ps(PositionX, _mm256_mul_ps(VelocityX, Step));
+		const __m256 NewPositionY = _mm256_add_ps(PositionY, _mm256_mul_ps(VelocityY, Step));
+
+		const __m256 Damping = _mm256_mul_ps(_mm256_mul_ps(Friction, LinearDrag), Step);
+		VelocityX = _mm256_sub_ps(VelocityX, _mm256_mul_ps(VelocityX, Damping));
+		VelocityY = _mm256_sub_ps(VelocityY, _mm256_mul_ps(VelocityY, Damping));
+
+		const __m256 Turn = _mm256_mul_ps(_mm256_mul_ps(AngularVelocity, DegreesToRadians), Step);
+		const __m256 TurnCos = _mm256_sub_ps(RotationCos, _mm256_mul_ps(RotationSin, Turn));
+		const __m256 TurnSin = _mm256_add_ps(RotationSin, _mm256_mul_ps(RotationCos, Turn));
+		const __m256 InverseLength = _mm256_div_ps(One, _mm256_sqrt_ps(_mm256_add_ps(_mm256_mul_ps(TurnCos, TurnCos), _mm256_mul_ps(TurnSin, TurnSin))));
+		const __m256 Turning = _mm256_and_ps(Awake, _mm256_cmp_ps(Turn, Zero, _CMP_NEQ_UQ));
+		AngularVelocity = _mm256_sub_ps(AngularVelocity, _mm256_mul_ps(_mm256_mul_ps(AngularVelocity, AngularDrag), Step));
+
+		const __m256 SpeedSquared = _mm256_add_ps(_mm256_mul_ps(VelocityX, VelocityX), _mm256_mul_ps(VelocityY, VelocityY));
+		const __m256 StopLinear = _mm256_cmp_ps(SpeedSquared, LinearThresholdSquared, _CMP_LT_OQ);
+		const __m256 StopAngular = _mm256_cmp_ps(_mm256_andnot_ps(SignMask, AngularVelocity), RotationThreshold, _CMP_LT_OQ);
+
+		VelocityX = _mm256_andnot_ps(StopLinear, VelocityX);
+		VelocityY = _mm256_andnot_ps(StopLinear, VelocityY);
+		AngularVelocity = _mm256_andnot_ps(StopAngular, AngularVelocity);
+
+		// Sleeping bodies are left exactly as they were, and so is the rotor of anything that isn't turning
+		_mm256_storeu_ps(&Bodies.PositionX[i], _mm256_blendv_ps(PositionX, NewPositionX, Awake));
+		_mm256_storeu_ps(&Bodies.PositionY[i], _mm256_blendv_ps(PositionY, NewPositionY, Awake));
+		_mm256_storeu_ps(&Bodies.RotationCos[i], _mm256_blendv_ps(RotationCos, _mm256_mul_ps(TurnCos, InverseLength), Turning));
+		_mm256_storeu_ps(&Bodies.RotationSin[i], _mm256_blendv_ps(RotationSin, _mm256_mul_ps(TurnSin, InverseLength), Turning));
+		_mm256_storeu_ps(&Bodies.VelocityX[i], _mm256_blendv_ps(OldVelocityX, VelocityX, Awake));
+		_mm256_storeu_ps(&Bodies.VelocityY[i], _mm256_blendv_ps(OldVelocityY, VelocityY, Awake));
+		_mm256_storeu_ps(&Bodies.AngularVelocity[i], _mm256_blendv_ps(OldAngularVelocity, AngularVelocity, Awake));
+	}
+
+	return i;
+}
+
+#else
+
+unsigned int Integrator::IntegrateSSE(BodyStore&, glm::vec2, float, const unsigned int First, unsigned int)
+{
+	return First;
+}
+
+unsigned int Integrator::IntegrateAVX(BodyStore&, glm::vec2, float, const unsigned int First, unsigned int)
+{
+	return First;
+}
+
+#endif
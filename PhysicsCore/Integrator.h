@@ -0,0 +1,32 @@
+#pragma once
+#include "BodyStore.h"
+
+#include <glm/vec2.hpp>
+
+enum IntegratorPath
+{
+	INTEGRATOR_SCALAR, INTEGRATOR_SSE, INTEGRATOR_AVX
+};
+
+// The SIMD paths do the same operations in the same order as the scalar loop, one body per lane,
+// so they give the same results bit for bit. The only exception is a compiler fusing the scalar
+// multiply-adds into FMA instructions, which stays within this relative tolerance. PhysicsBenchmark --verify checks it
+static const float INTEGRATOR_TOLERANCE = 1e-5f;
+
+// Applies gravity, drag and the velocity thresholds to every awake body in a BodyStore, 4 or 8 bodies at a time when the CPU allows it
+// Gravity pulls on the centre of mass, so unlike ApplyForce it never turns a body. Spins slower than MIN_ROTATION_THRESHOLD stop
+class Integrator
+{
+public:
+	static void Integrate(BodyStore& Bodies, glm::vec2 Gravity, float TimeStep, IntegratorPath Path);
+
+	// Widest path the CPU running this supports
+	static IntegratorPath DetectPath();
+
+private:
+	// Each of these integrates [First, Last) and returns where it stopped, the rest is left for the scalar loop
+	static unsigned int IntegrateScalar(BodyStore& Bodies, glm::vec2 Gravity, float TimeStep, unsigned int First, unsigned int Last);
+	static unsigned int IntegrateSSE(BodyStore& Bodies, glm::vec2 Gravity, float TimeStep, unsigned int First, unsigned int Last);
+	static unsigned int IntegrateAVX(BodyStore& Bodies, glm::vec2 Gravity, float TimeStep, unsigned int First, unsigned int Last);
+};
+
@@ -0,0 +1,107 @@
+#include "IslandManager.h"
+
+#include <cfloat>
+#include <cmath>
+
+IslandManager::IslandManager() = default;
+IslandManager::~IslandManager() = default;
+
+void IslandManager::Update(BodyStore& Bodies, const std::vector<Manifold>& Contacts, const float TimeStep, const float TimeToSleep)
+{
+	const unsigned int Count = Bodies.GetCount();
+
+	Parent.resize(Count);
+
+	for (unsigned int i = 0; i < Count; i++)
+		Parent[i] = i;
+
+	// A body that is still moving resets its timer, and with it the timer of its whole island
+	const float LinearThresholdSquared = SLEEP_LINEAR_THRESHOLD * SLEEP_LINEAR_THRESHOLD;
+
+	for (unsigned int i = 0; i < Count; i++)
+	{
+		if (!Bodies.IsActive(i))
+			continue;
+
+		const float SpeedSquared = Bodies.VelocityX[i] * Bodies.VelocityX[i] + Bodies.VelocityY[i] * Bodies.VelocityY[i];
+
+		if (SpeedSquared < LinearThresholdSquared && fabsf(Bodies.AngularVelocity[i]) < SLEEP_ANGULAR_THRESHOLD)
+			Bodies.SleepTime[i] += TimeStep;
+		else
+			Bodies.SleepTime[i] = 0.0f;
+	}
+
+	for (const Manifold& M : Contacts)
+	{
+		const unsigned int A = M.A->GetBodyIndex();
+		const unsigned int B = M.B->GetBodyIndex();
+
+		if (!Bodies.IsStatic(A) && !Bodies.IsStatic(B))
+			Join(A, B);
+	}
+
+	bIslandAwake.assign(Count, 0);
+	IslandSleepTime.assign(Count, FLT_MAX);
+	IslandCount = 0;
+
+	for (unsigned int i = 0; i < Count; i++)
+	{
+		if (Bodies.IsStatic(i))
+			continue;
+
+		const unsigned int Root = Find(i);
+
+		if (Root == i)
+			IslandCount++;
+
+		if (Bodies.IsAwake(i))
+			bIslandAwake[Root] = 1;
+
+		if (Bodies.SleepTime[i] < IslandSleepTime[Root])
+			IslandSleepTime[Root] = Bodies.SleepTime[i];
+	}
+
+	for (unsigned int i = 0; i < Count; i++)
+	{
+		if (Bodies.IsStatic(i))
+			continue;
+
+		const unsigned int Root = Find(i);
+
+		// Nothing awake touched this island, leave it alone
+		if (!bIslandAwake[Root])
+			continue;
+
+		if (IslandSleepTime[Root] >= TimeToSleep)
+		{
+			if (Bodies.IsAwake(i))
+				Bodies.SetAwake(i, false);
+		}
+		else if (!Bodies.IsAwake(i))
+			Bodies.SetAwake(i, true);
+	}
+}
+
+unsigned int IslandManager::Find(unsigned int Index)
+{
+	while (Parent[Index] != Index)
+	{
+		// Halve the path on the way up
+		Parent[Index] = Parent[Parent[Index]];
+		Index = Parent[Index];
+	}
+
+	return Index;
+}
+
+void IslandManager::Join(const unsigned int A, const unsigned int B)
+{
+	const unsigned int RootA = Find(A);
+	const unsigned int RootB = Find(B);
+
+	// Smaller index wins so the islands come out the same every run
+	if (RootA < RootB)
+		Parent[RootB] = RootA;
+	else if (RootB < RootA)
+		Parent[RootA] = RootB;
+}
@@ -0,0 +1,35 @@
+#pragma once
+#include "BodyStore.h"
+#include "Manifold.h"
+
+#include <vector>
+
+// Groups bodies that touch each other into islands and puts whole islands to sleep once they have settled.
+// Statics never join an island, so two piles resting on the same floor sleep and wake on their own.
+// Sleeping bodies don't report contacts with each other, so a pile that gets knocked wakes one layer per step
+class IslandManager
+{
+public:
+	IslandManager();
+	~IslandManager();
+
+	// Call after the solver, so the timers see the velocities the bodies will actually keep
+	void Update(BodyStore& Bodies, const std::vector<Manifold>& Contacts, float TimeStep, float TimeToSleep);
+
+	// Islands found by the last Update, every sleeping body counts as its own
+	unsigned int GetIslandCount() const { return IslandCount; }
+
+private:
+	unsigned int Find(unsigned int Index);
+	void Join(unsigned int A, unsigned int B);
+
+	// Union find over body indices
+	std::vector<unsigned int> Parent;
+
+	// Indexed by the root body of each island
+	std::vector<unsigned char> bIslandAwake;
+	std::vector<float> IslandSleepTime;
+
+	unsigned int IslandCount{};
+};
+
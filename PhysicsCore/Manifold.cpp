@@ -0,0 +1,15 @@
+#include "Manifold.h"
+
+Manifold::Manifold() = default;
+Manifold::~Manifold() = default;
+
+void Manifold::Reset(Object* A, Object* B)
+{
+	this->A = A;
+	this->B = B;
+	Penetration = 0.05f;
+	Normal = {};
+	ContactsCount = 0;
+	bHasPoints = false;
+	Feature = 0;
+}
\ No newline at end of file
@@ -0,0 +1,42 @@
+#pragma once
+#include "Object.h"
+
+// Two boxes resting face to face touch at both ends of the face, nothing needs more than that in 2D
+static const unsigned int MAX_CONTACT_POINTS = 2;
+
+struct ContactPoint
+{
+	glm::vec2 Location{}; // World space, halfway between the two surfaces
+	float Penetration{};
+	unsigned int Feature{};
+};
+
+class Manifold
+{
+public:
+	Manifold();
+	~Manifold();
+
+	// Reuse this manifold for another pair
+	void Reset(Object* A, Object* B);
+
+	Object* A{};
+	Object* B{};
+
+	// How far the shapes overlap along Normal
+	float Penetration{ 0.05f };
+
+	// Points from A to B
+	glm::vec2 Normal{};
+
+	unsigned int ContactsCount{};
+
+	// Filled in by routines that find where the shapes touch, which sets bHasPoints. The others only set Penetration
+	// and the solver pushes on both centres instead
+	ContactPoint Points[MAX_CONTACT_POINTS];
+	bool bHasPoints{};
+
+	// Tells contacts between the same pair apart from one step to the next, zero when a routine only ever finds one
+	unsigned int Feature{};
+};
+
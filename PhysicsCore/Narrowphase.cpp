@@ -0,0 +1,327 @@
+#include "Narrowphase.h"
+
+#include <glm/glm.hpp>
+#include <cfloat>
+#include <cmath>
+
+bool Narrowphase::CircleToCircle(const CircleShape& A, const CircleShape& B, Manifold* M)
+{
+	// Calculate the normal
+	const glm::vec2 Normal = B.Centre - A.Centre;
+
+	const float DistanceSquared = dot(Normal, Normal);
+
+	float RadiiSum = A.Radius + B.Radius;
+	RadiiSum *= RadiiSum;
+
+	if (DistanceSquared > RadiiSum)
+		return false;
+
+	const float Length = sqrtf(DistanceSquared);
+
+	M->ContactsCount = 1;
+	M->Penetration = A.Radius + B.Radius - Length;
+
+	// Circles sitting exactly on top of each other have no direction, push them apart vertically
+	M->Normal = DistanceSquared > 0.0f ? Normal * (1.0f / Length) : glm::vec2(0.0f, 1.0f);
+
+	return true;
+}
+
+bool Narrowphase::BoxToCircle(const BoxShape& Box, const CircleShape& Circle, Manifold* M)
+{
+	// Find the closest point on the box, in its own space where that is a clamp
+	const glm::vec2 Local = Box.ToLocal(Circle.Centre);
+	const glm::vec2 ClosestPoint = clamp(Local, -Box.Extent, Box.Extent);
+
+	const glm::vec2 Distance = Local - ClosestPoint;
+	const float DistanceSquared = dot(Distance, Distance);
+
+	if (DistanceSquared >= Circle.Radius * Circle.Radius)
+		return false;
+
+	M->ContactsCount = 1;
+	M->Penetration = Circle.Radius - sqrtf(DistanceSquared);
+
+	// A centre inside the box has no closest point to push away from, use the direction between the centres instead
+	const glm::vec2 Normal = DistanceSquared > 0.0f ? Distance : Local;
+	M->Normal = dot(Normal, Normal) > 0.0f ? normalize(Box.ToWorldDirection(Normal)) : glm::vec2(0.0f, 1.0f);
+
+	return true;
+}
+
+// Largest gap between a face of A and the whole of B, positive means they are apart
+static float MaxSeparation(const BoxShape& A, const BoxShape& B, int& OutFace)
+{
+	float Best = -FLT_MAX;
+
+	for (int Face = 0; Face < 4; Face++)
+	{
+		const glm::vec2 Normal = A.FaceNormal(Face);
+		const float Separation = dot(Normal, B.Centre - A.Centre) - A.Extent[Face & 1] - B.Reach(Normal);
+
+		if (Separation > Best)
+		{
+			Best = Separation;
+			OutFace = Face;
+		}
+	}
+
+	return Best;
+}
+
+struct ClipVertex
+{
+	glm::vec2 Location;
+	unsigned int Feature; // 0 to 3 for a corner of the incident box, 4 to 7 where a side of the reference face cut it
+};
+
+// Keeps the part of the segment where dot(Normal, Point) <= Offset. Returns how many ends are left
+static int ClipSegment(const ClipVertex In[2], ClipVertex Out[2], const glm::vec2 Normal, const float Offset, const unsigned int ClipFeature)
+{
+	int Count = 0;
+
+	const float Distance0 = dot(Normal, In[0].Location) - Offset;
+	const float Distance1 = dot(Normal, In[1].Location) - Offset;
+
+	if (Distance0 <= 0.0f)
+		Out[Count++] = In[0];
+
+	if (Distance1 <= 0.0f)
+		Out[Count++] = In[1];
+
+	// The ends are on opposite sides, so the crossing point takes the place of the one that was cut
+	if (Distance0 * Distance1 < 0.0f)
+	{
+		const float t = Distance0 / (Distance0 - Distance1);
+
+		Out[Count].Location = In[0].Location + (In[1].Location - In[0].Location) * t;
+		Out[Count].Feature = ClipFeature;
+		Count++;
+	}
+
+	return Count;
+}
+
+// SAT to find the face of least penetration, then the other box's most opposed face is clipped against it to give
+// up to two points, each with its own depth. Features name the faces and corners involved, so the solver can match
+// the points up with the same ones last step
+bool Narrowphase::BoxToBox(const BoxShape& A, const BoxShape& B, Manifold* M)
+{
+	int FaceA = 0;
+	const float SeparationA = MaxSeparation(A, B, FaceA);
+
+	if (SeparationA > 0.0f)
+		return false;
+
+	int FaceB = 0;
+	const float SeparationB = MaxSeparation(B, A, FaceB);
+
+	if (SeparationB > 0.0f)
+		return false;
+
+	// Stick with A's face unless B's is clearly better, so near ties don't swap the reference face every step
+	const bool bFlip = SeparationB > 0.98f * SeparationA + 0.001f;
+
+	const BoxShape& Reference = bFlip ? B : A;
+	const BoxShape& Incident = bFlip ? A : B;
+	const int ReferenceFace = bFlip ? FaceB : FaceA;
+	const glm::vec2 Normal = Reference.FaceNormal(ReferenceFace);
+
+	// The incident face is the one facing most against the reference face
+	int IncidentFace = 0;
+	float MinDot = FLT_MAX;
+
+	for (int Face = 0; Face < 4; Face++)
+	{
+		const float Dot = dot(Normal, Incident.FaceNormal(Face));
+
+		if (Dot < MinDot)
+		{
+			MinDot = Dot;
+			IncidentFace = Face;
+		}
+	}
+
+	ClipVertex IncidentEdge[2];
+	Incident.FaceVertices(IncidentFace, IncidentEdge[0].Location, IncidentEdge[1].Location);
+	IncidentEdge[0].Feature = IncidentFace;
+	IncidentEdge[1].Feature = (IncidentFace + 1) & 3;
+
+	glm::vec2 Start, End;
+	Reference.FaceVertices(ReferenceFace, Start, End);
+
+	const glm::vec2 Tangent = normalize(End - Start);
+
+	// Trim the incident face to the length of the reference face
+	ClipVertex Clipped[2];
+	ClipVertex Trimmed[2];
+
+	if (ClipSegment(IncidentEdge, Clipped, -Tangent, -dot(Tangent, Start), 4 + ReferenceFace) < 2)
+		return false;
+
+	if (ClipSegment(Clipped, Trimmed, Tangent, dot(Tangent, End), 4 + ((ReferenceFace + 1) & 3)) < 2)
+		return false;
+
+	// Only what is below the reference face is touching
+	const float FaceOffset = dot(Normal, Start);
+	unsigned int Count = 0;
+	float Deepest = 0.0f;
+
+	for (const ClipVertex& Vertex : Trimmed)
+	{
+		const float Separation = dot(Normal, Vertex.Location) - FaceOffset;
+
+		if (Separation > 0.0f)
+			continue;
+
+		ContactPoint& Point = M->Points[Count++];
+		Point.Location = Vertex.Location - Normal * (Separation * 0.5f);
+		Point.Penetration = -Separation;
+		Point.Feature = (bFlip ? 1u << 12 : 0u) | ReferenceFace << 8 | IncidentFace << 4 | Vertex.Feature;
+
+		Deepest = fmaxf(Deepest, Point.Penetration);
+	}
+
+	if (Count == 0)
+		return false;
+
+	M->ContactsCount = Count;
+	M->Penetration = Deepest;
+	M->Feature = M->Points[0].Feature;
+	M->bHasPoints = true;
+
+	// The reference normal points out of whichever box owns the face
+	M->Normal = bFlip ? -Normal : Normal;
+
+	return true;
+}
+
+bool Narrowphase::SegmentToBox(const SegmentShape& Segment, const BoxShape& Box, Manifold* M)
+{
+	// Work in the box's own space, where it is an AABB at the origin
+	const glm::vec2 Start = Box.ToLocal(Segment.Start);
+	const glm::vec2 End = Box.ToLocal(Segment.End);
+
+	const glm::vec2 Min = -Box.Extent;
+	const glm::vec2 Max = Box.Extent;
+
+	// An end inside the box touches it whatever the rest of the segment does
+	const bool bStartInside = Min.x <= Start.x && Min.y <= Start.y && Start.x <= Max.x && Start.y <= Max.y;
+	const bool bEndInside = Min.x <= End.x && Min.y <= End.y && End.x <= Max.x && End.y <= Max.y;
+
+	if (!bStartInside && !bEndInside)
+	{
+		// Do raycast against the box
+		const glm::vec2 Direction = normalize(End - Start);
+
+		float tmin = -FLT_MAX;
+		float tmax = FLT_MAX;
+
+		for (int Axis = 0; Axis < 2; Axis++)
+		{
+			// A ray parallel to this axis misses unless it runs between the sides, and then puts no limit on t
+			if (Direction[Axis] == 0.0f)
+			{
+				if (Start[Axis] < Min[Axis] || Start[Axis] > Max[Axis])
+					return false;
+
+				continue;
+			}
+
+			const float InverseDirection = 1.0f / Direction[Axis];
+			const float Near = (Min[Axis] - Start[Axis]) * InverseDirection;
+			const float Far = (Max[Axis] - Start[Axis]) * InverseDirection;
+
+			tmin = fmaxf(tmin, fminf(Near, Far));
+			tmax = fminf(tmax, fmaxf(Near, Far));
+		}
+
+		// if tmax < 0, the ray is intersecting the box, but the box is behind us.
+		// OR if tmin > tmax the ray doesn't intersect the box
+		if (tmax < 0 || tmin > tmax)
+			return false;
+
+		// Ray intersects the box
+		const float t = tmin < 0.0f ? tmax : tmin;
+
+		// If ray hits and the length of the ray is less than the length of the line, we have a collision
+		if (t <= 0.0f || t * t >= dot(End - Start, End - Start))
+			return false;
+	}
+
+	// Which side of the line the centre is on, and how far the box reaches past it
+	const glm::vec2 UnitNormal = normalize(Segment.Normal);
+	const float CentreDistance = dot(Box.Centre - Segment.Start, UnitNormal);
+
+	M->ContactsCount = 1;
+	M->Penetration = Box.Reach(UnitNormal) - fabsf(CentreDistance);
+	M->Normal = CentreDistance < 0.0f ? -Segment.Normal : Segment.Normal;
+
+	// The two corners furthest through the line are the points, so a box lying on it is held up at both ends
+	const glm::vec2 Facing = CentreDistance < 0.0f ? -UnitNormal : UnitNormal;
+	unsigned int Count = 0;
+
+	for (unsigned int Corner = 0; Corner < 4; Corner++)
+	{
+		const glm::vec2 Sides = { Corner == 0 || Corner == 3 ? 1.0f : -1.0f, Corner < 2 ? 1.0f : -1.0f };
+		const glm::vec2 Location = Box.Centre + Box.ToWorldDirection(Sides * Box.Extent);
+		const float Separation = dot(Location - Segment.Start, Facing);
+
+		if (Separation > 0.0f)
+			continue;
+
+		// Replace the shallower point once both are taken
+		unsigned int Slot = Count;
+
+		if (Count == MAX_CONTACT_POINTS)
+		{
+			Slot = M->Points[0].Penetration < M->Points[1].Penetration ? 0 : 1;
+
+			if (M->Points[Slot].Penetration >= -Separation)
+				continue;
+		}
+		else
+			Count++;
+
+		ContactPoint& Point = M->Points[Slot];
+		Point.Location = Location - Facing * (Separation * 0.5f);
+		Point.Penetration = -Separation;
+		Point.Feature = Corner;
+	}
+
+	// A line poking into the side of the box has no corner through it, that stays a push between the centres
+	if (Count > 0)
+	{
+		M->ContactsCount = Count;
+		M->Feature = M->Points[0].Feature;
+		M->bHasPoints = true;
+	}
+
+	return true;
+}
+
+bool Narrowphase::SegmentToCircle(const SegmentShape& Segment, const CircleShape& Circle, Manifold* M)
+{
+	const glm::vec2 AB = Segment.End - Segment.Start;
+	const float t = dot(Circle.Centre - Segment.Start, AB) / dot(AB, AB);
+
+	if (t < 0.0f || t > 1.0f)
+		return false;
+
+	const glm::vec2 ClosestPoint = Segment.Start + AB * t;
+	const glm::vec2 Offset = Circle.Centre - ClosestPoint;
+
+	const float DistanceSquared = dot(Offset, Offset);
+
+	if (DistanceSquared >= Circle.Radius * Circle.Radius * 1.1f) // 1.1 - offset
+		return false;
+
+	M->ContactsCount = 1;
+	M->Penetration = Circle.Radius - sqrtf(DistanceSquared);
+
+	// If we are behind the plane, then flip the normal
+	M->Normal = dot(Circle.Centre - Segment.Start, Segment.Normal) < 0.0f ? -Segment.Normal : Segment.Normal;
+
+	return true;
+}
@@ -0,0 +1,20 @@
+#pragma once
+#include "Manifold.h"
+#include "ShapeProxy.h"
+
+// Contact tests on plain shape descriptions. The World routines look up the shapes behind a pair and call one of these,
+// which only fill in the manifold's normal, depth and contact points, never the objects it points at.
+// The normal always points from the first shape to the second
+class Narrowphase
+{
+public:
+	static bool CircleToCircle(const CircleShape& A, const CircleShape& B, Manifold* M);
+	static bool BoxToCircle(const BoxShape& Box, const CircleShape& Circle, Manifold* M);
+
+	// Up to two points, see Manifold::Points
+	static bool BoxToBox(const BoxShape& A, const BoxShape& B, Manifold* M);
+
+	// The deepest two corners when any are through the line
+	static bool SegmentToBox(const SegmentShape& Segment, const BoxShape& Box, Manifold* M);
+	static bool SegmentToCircle(const SegmentShape& Segment, const CircleShape& Circle, Manifold* M);
+};
@@ -0,0 +1,108 @@
+#include "OBB.h"
+
+#include <glm/ext.hpp>
+#include <cstdio>
+
+OBB::OBB()
+{
+	this->Location = {0.0f, 0.0f};
+	this->HalfExtent = {1.0f, 1.0f};
+	this->Mass = 1;
+	this->InverseMass = 1;
+	this->LinearDrag = 0.0f;
+	this->AngularDrag = 0.0f;
+	this->Color = {1.0f, 0.0f, 0.0f, 1.0f};
+
+	Shape = Geometry::OBB;
+	Frame = BuildFrame(this->Location, Rotor, HalfExtent);
+}
+
+OBB::OBB(glm::vec2 Location, glm::vec2 Velocity, glm::vec2 Extent, float Rotation, float Mass, glm::vec4 Color)
+{
+	this->Location = Location;
+	this->Velocity = Velocity;
+	this->HalfExtent = Extent;
+	this->Rotor = { cosf(DEG2RAD(Rotation)), sinf(DEG2RAD(Rotation)) };
+	this->Mass = Mass;
+	this->Color = Color;
+
+	this->LinearDrag = 0.3f;
+	this->AngularDrag = 0.3f;
+
+	if (this->Mass == 0)
+		this->InverseMass = 0;
+	else
+		this->InverseMass = 1.0f / Mass;
+	
+	this->AngularVelocity = 10.0f;
+
+	// A solid rectangle turning about its centre, m(w*w + h*h) / 12
+	this->Moment = Mass * (Extent.x * Extent.x + Extent.y * Extent.y) / 3.0f;
+
+	Shape = Geometry::OBB;
+	Frame = BuildFrame(Location, Rotor, HalfExtent);
+}
+
+OBB::~OBB() = default;
+
+void OBB::UpdateFrame()
+{
+	// Resting and kinematic boxes keep theirs, which is most of them
+	if (!IsFrameCurrent())
+		Frame = BuildFrame(GetLocation(), GetRotor(), HalfExtent);
+}
+
+OBB::BoxFrame OBB::BuildFrame(const glm::vec2 Location, const glm::vec2 Rotor, const glm::vec2 Extent)
+{
+	BoxFrame Result;
+
+	const float CS = Rotor.x;
+	const float SN = Rotor.y;
+
+	Result.Axes[0] = { CS, SN };
+	Result.Axes[1] = { -SN, CS };
+
+	const glm::vec2 X = Result.Axes[0] * Extent.x;
+	const glm::vec2 Y = Result.Axes[1] * Extent.y;
+
+	Result.Corners[0] = Location - X - Y;
+	Result.Corners[1] = Location + X + Y;
+	Result.Corners[2] = Location - X + Y;
+	Result.Corners[3] = Location + X - Y;
+
+	// Extent of the rotated box projected onto the world axes
+	const glm::vec2 Reach = { fabsf(CS) * Extent.x + fabsf(SN) * Extent.y, fabsf(SN) * Extent.x + fabsf(CS) * Extent.y };
+	Result.Box = { Location - Reach, Location + Reach };
+
+	Result.Location = Location;
+	Result.Rotor = Rotor;
+
+	return Result;
+}
+
+glm::mat4 OBB::GetTransform() const
+{
+	const glm::vec2& AxisX = Frame.Axes[0];
+	const glm::vec2& AxisY = Frame.Axes[1];
+
+	return {AxisX.x, AxisX.y, 0, 0,
+			AxisY.x, AxisY.y, 0, 0,
+			0,  0,  1.0f, 0,
+			0,  0,  0, 1.0f};
+}
+
+void OBB::Debug()
+{
+	printf("Location X: %f, Y: %f\n", GetLocation().x, GetLocation().y);
+	printf("Rotation: %f\n", GetRotation());
+	//printf("AngVelocity: %f\n", AngularVelocity);
+}
+
+Bounds OBB::GetBounds() const
+{
+	// Moved by hand since the last UpdateFrame, so work it out without touching the cache
+	if (!IsFrameCurrent())
+		return BuildFrame(GetLocation(), GetRotor(), HalfExtent).Box;
+
+	return Frame.Box;
+}
@@ -0,0 +1,49 @@
+#pragma once
+#include "Object.h"
+
+#include <glm/mat4x4.hpp>
+
+class OBB final : public Object
+{
+public:
+	OBB();
+	OBB(glm::vec2 Location, glm::vec2 Velocity, glm::vec2 Extent, float Rotation, float Mass, glm::vec4 Color);
+	~OBB();
+
+	void Debug() override;
+	Bounds GetBounds() const override;
+
+	glm::vec2 GetExtent() const { return HalfExtent; }
+
+	// Rebuilds the cached axes, corners and bounds, but only if the box has moved or turned since they were last built.
+	// World does this once per substep before anything reads them, so the narrowphase threads never write to a box
+	void UpdateFrame();
+
+	// Unit axes of the box in world space, as of the last UpdateFrame
+	const glm::vec2& GetAxisX() const { return Frame.Axes[0]; }
+	const glm::vec2& GetAxisY() const { return Frame.Axes[1]; }
+
+	// World space corners as of the last UpdateFrame, bottom left - top right - top left - bottom right before rotating
+	const glm::vec2* GetCorners() const { return Frame.Corners; }
+
+	// Rotation matrix built from the cached axes
+	glm::mat4 GetTransform() const;
+
+private:
+	struct BoxFrame
+	{
+		glm::vec2 Axes[2];
+		glm::vec2 Corners[4];
+		Bounds Box;
+
+		// What it was built from
+		glm::vec2 Location;
+		glm::vec2 Rotor;
+	};
+
+	glm::vec2 HalfExtent{};
+	BoxFrame Frame{};
+
+	bool IsFrameCurrent() const { return Frame.Rotor == GetRotor() && Frame.Location == GetLocation(); }
+	static BoxFrame BuildFrame(glm::vec2 Location, glm::vec2 Rotor, glm::vec2 Extent);
+};
@@ -0,0 +1,84 @@
+#include "Object.h"
+
+#include <glm/ext.hpp>
+#include <cmath>
+
+Object::Object() = default;
+
+void Object::ApplyForce(const glm::vec2 Force)
+{
+	if (Store != nullptr)
+	{
+		Store->ApplyForce(BodyIndex, Force);
+		return;
+	}
+
+	Velocity += Force / Mass; // A = F / M formula
+	AngularVelocity += (Force.y * Location.x - Force.x * Location.y) / Moment;
+}
+
+float Object::GetRotation() const
+{
+	const glm::vec2 Rotor = GetRotor();
+
+	return RAD2DEG(atan2f(Rotor.y, Rotor.x));
+}
+
+void Object::SetLocation(const glm::vec2 Location)
+{
+	if (Store != nullptr)
+	{
+		Store->PositionX[BodyIndex] = Location.x;
+		Store->PositionY[BodyIndex] = Location.y;
+		Store->SetAwake(BodyIndex, true);
+		Store->SetMoved(BodyIndex, true);
+		return;
+	}
+
+	this->Location = Location;
+}
+
+void Object::SetKinematic(const bool State)
+{
+	if (Store != nullptr)
+	{
+		Store->SetKinematic(BodyIndex, State);
+		Store->SetAwake(BodyIndex, true);
+		return;
+	}
+
+	bIsKinematic = State;
+}
+
+void Object::SetBullet(const bool State)
+{
+	if (Store != nullptr)
+	{
+		Store->SetBullet(BodyIndex, State);
+		return;
+	}
+
+	bIsBullet = State;
+}
+
+void Object::SetCollisionFilter(const CollisionFilter& Filter)
+{
+	this->Filter = Filter;
+
+	// Pairs that were filtered out may be resting inside each other, so let them sort it out
+	if (Store != nullptr)
+		Store->SetAwake(BodyIndex, true);
+}
+
+void Object::SetAwake(const bool State)
+{
+	if (Store != nullptr)
+		Store->SetAwake(BodyIndex, State);
+}
+
+bool Object::IsOutside(const Bounds& Region) const
+{
+	const glm::vec2 Location = GetLocation();
+
+	return Location.x > Region.Max.x || Location.x < Region.Min.x || Location.y > Region.Max.y || Location.y < Region.Min.y;
+}
\ No newline at end of file
@@ -0,0 +1,141 @@
+#pragma once
+#include <glm/vec2.hpp>
+#include <glm/vec4.hpp>
+
+#include "BodyStore.h"
+
+class OBB;
+
+static const float MIN_LINEAR_THRESHOLD = 0.1f;
+static const float MIN_ROTATION_THRESHOLD = 0.01f;
+
+// A body has to stay below both of these for a World's sleep time before its island can sleep
+static const float SLEEP_LINEAR_THRESHOLD = 0.5f;
+static const float SLEEP_ANGULAR_THRESHOLD = 0.05f;
+
+#define DEG2RAD(x) ((x) * 0.0174533f)
+#define RAD2DEG(x) ((x) * 57.2958f)
+
+enum Geometry
+{
+	AABB, OBB, CIRCLE, PLANE, LAST
+};
+
+struct Interval
+{
+	float Min, Max;
+};
+
+struct Bounds
+{
+	glm::vec2 Min, Max;
+};
+
+// Two bodies only collide if each one's category is in the other's mask.
+// Bodies sharing a non zero group skip that test, a positive group always collides and a negative group never does
+struct CollisionFilter
+{
+	unsigned short Category{0x0001};
+	unsigned short Mask{0xFFFF};
+	short Group{0};
+};
+
+class Object
+{
+public:
+	Object();
+	virtual ~Object() = default;
+
+	void ApplyForce(glm::vec2 Force);
+
+	// Drawing lives outside the core, see GizmoRenderer in the app
+	virtual void Debug() = 0;
+
+	// World space box that encloses the whole shape, used by the broadphase
+	virtual Bounds GetBounds() const = 0;
+
+	// Once added to a World the simulated values live in its BodyStore, until then they live in the object itself
+	glm::vec2 GetLocation() const { return Store ? glm::vec2(Store->PositionX[BodyIndex], Store->PositionY[BodyIndex]) : Location; }
+	glm::vec2 GetVelocity() const { return Store ? glm::vec2(Store->VelocityX[BodyIndex], Store->VelocityY[BodyIndex]) : Velocity; }
+	glm::vec2 GetNormal() const { return Normal; }
+	glm::vec4 GetColor() const { return Color; }
+	Geometry GetShape() const { return Shape; }
+
+	// Rotation as a unit complex number (cos, sin), which is what the simulation keeps. Rotating by it is a 2x2 multiply
+	glm::vec2 GetRotor() const { return Store ? glm::vec2(Store->RotationCos[BodyIndex], Store->RotationSin[BodyIndex]) : Rotor; }
+
+	// In degrees, worked out from the rotor, so keep it out of anything that runs per pair or per body
+	float GetRotation() const;
+	float GetMass() const { return Store ? Store->Mass[BodyIndex] : Mass; }
+	float GetInverseMass() const { return Store ? Store->InverseMass[BodyIndex] : InverseMass; }
+	float GetRestitution() const { return Restitution; }
+	float GetAngularVelocity() const { return Store ? Store->AngularVelocity[BodyIndex] : AngularVelocity; }
+	float GetMoment() const { return Moment; }
+	float GetFriction() const { return Store ? Store->Friction[BodyIndex] : Friction; }
+
+	void SetLocation(glm::vec2 Location);
+	void SetKinematic(bool State);
+	void SetNormal(const glm::vec2 Normal) { this->Normal = Normal; }
+	void SetCollisionFilter(const CollisionFilter& Filter);
+
+	const CollisionFilter& GetCollisionFilter() const { return Filter; }
+
+	bool IsKinematic() const { return Store ? Store->IsKinematic(BodyIndex) : bIsKinematic; }
+
+	// Kinematic bodies and planes never move on their own, so they are never integrated or paired with each other
+	bool IsStatic() const { return Store ? Store->IsStatic(BodyIndex) : bIsKinematic || Shape == PLANE; }
+
+	// Bullets are swept against planes and kinematic bodies every step, so they can't tunnel through them however fast
+	// they go. Only circles are swept, and only against static shapes, other moving bodies still need the step to be small enough
+	bool IsBullet() const { return Store ? Store->IsBullet(BodyIndex) : bIsBullet; }
+	void SetBullet(bool State);
+
+	// Whether SetLocation was called since the World last found pairs, which is the only way a static or sleeping body moves.
+	// Outside a World nothing keeps track, so it is always true
+	bool IsMoved() const { return Store ? Store->IsMoved(BodyIndex) : true; }
+
+	// Only bodies in a World can sleep
+	bool IsAwake() const { return Store ? Store->IsAwake(BodyIndex) : true; }
+	void SetAwake(bool State);
+
+	BodyStore* GetStore() const { return Store; }
+	unsigned int GetBodyIndex() const { return BodyIndex; }
+
+	// Only valid while the object is in a World, an empty handle otherwise
+	BodyHandle GetHandle() const { return Store ? Store->GetHandle(BodyIndex) : BodyHandle(); }
+
+	bool IsOutside(const Bounds& Region) const;
+
+protected:
+	glm::vec2 Rotor{1.0f, 0.0f};
+	float Mass{1.0f};
+	float InverseMass{ 1.0f / Mass };
+	float Restitution{1.0f};
+	float LinearDrag{0.3f};
+	float AngularDrag{0.3f};
+	float AngularVelocity{0.0f};
+	float Moment{1.0f};
+	float InverseMoment{ 1.0f / Moment };
+	float Torque{0.0f};
+	float Friction{0.7f};
+
+	glm::vec2 Location{};
+	glm::vec2 Velocity{1.0f, 1.0f};
+	glm::vec2 Normal{};
+
+	glm::vec4 Color{1.0f, 1.0f, 1.0f, 1.0f};
+
+	Geometry Shape{};
+
+	CollisionFilter Filter{};
+
+	bool bIsKinematic{false};
+	bool bIsBullet{false};
+
+private:
+	friend class BodyStore;
+
+	BodyStore* Store{};
+	unsigned int BodyIndex{};
+};
+
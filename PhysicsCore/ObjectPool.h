@@ -0,0 +1,142 @@
+#pragma once
+#include <functional>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+struct PoolStats
+{
+	unsigned int Capacity{};
+	unsigned int Live{};
+	unsigned int HighWater{}; // Most objects alive at once
+	unsigned long long Spawned{}; // Every Acquire since the pool was made
+};
+
+// Fixed slots for one type of object. Slots are built in place on Acquire and torn down on Release, so a reused slot
+// starts from a freshly constructed object, and nothing goes back to the heap until the pool itself does.
+// Grows by doubling, so even a big pool is only a handful of blocks
+template <typename T>
+class ObjectPool
+{
+public:
+	ObjectPool() = default;
+
+	~ObjectPool()
+	{
+		for (Block& Current : Blocks)
+		{
+			for (unsigned int i = 0; i < Current.Size; i++)
+			{
+				if (Current.Live[i])
+					Current.Get(i)->~T();
+			}
+		}
+	}
+
+	ObjectPool(const ObjectPool&) = delete;
+	ObjectPool& operator=(const ObjectPool&) = delete;
+
+	// Makes room for Capacity objects in total, so they can be acquired without allocating
+	void Reserve(const unsigned int Capacity)
+	{
+		if (Capacity > Stats.Capacity)
+			AddBlock(Capacity - Stats.Capacity);
+	}
+
+	template <typename... Arguments>
+	T* Acquire(Arguments&&... Values)
+	{
+		if (Free.empty())
+			AddBlock(Stats.Capacity > MIN_BLOCK_SIZE ? Stats.Capacity : MIN_BLOCK_SIZE);
+
+		const Slot Next = Free.back();
+		Free.pop_back();
+
+		Block& Owner = Blocks[Next.Block];
+		T* Item = new (Owner.Get(Next.Index)) T(std::forward<Arguments>(Values)...);
+		Owner.Live[Next.Index] = true;
+
+		Stats.Live++;
+		Stats.Spawned++;
+
+		if (Stats.Live > Stats.HighWater)
+			Stats.HighWater = Stats.Live;
+
+		return Item;
+	}
+
+	// Returns false for anything this pool didn't hand out
+	bool Release(T* Item)
+	{
+		const std::less<const T*> Before;
+
+		for (unsigned int BlockIndex = 0; BlockIndex < Blocks.size(); BlockIndex++)
+		{
+			Block& Current = Blocks[BlockIndex];
+
+			if (Before(Item, Current.Get(0)) || !Before(Item, Current.Get(0) + Current.Size))
+				continue;
+
+			const unsigned int Index = static_cast<unsigned int>(Item - Current.Get(0));
+
+			if (!Current.Live[Index])
+				return false;
+
+			Item->~T();
+			Current.Live[Index] = false;
+
+			// Handed out again first, while it is still in cache
+			Free.push_back({ BlockIndex, Index });
+			Stats.Live--;
+
+			return true;
+		}
+
+		return false;
+	}
+
+	const PoolStats& GetStats() const { return Stats; }
+
+private:
+	static const unsigned int MIN_BLOCK_SIZE = 64;
+
+	typedef typename std::aligned_storage<sizeof(T), alignof(T)>::type Storage;
+
+	struct Block
+	{
+		std::unique_ptr<Storage[]> Items;
+		std::vector<bool> Live;
+		unsigned int Size;
+
+		T* Get(const unsigned int Index) const { return reinterpret_cast<T*>(&Items[Index]); }
+	};
+
+	struct Slot
+	{
+		unsigned int Block;
+		unsigned int Index;
+	};
+
+	std::vector<Block> Blocks;
+	std::vector<Slot> Free;
+
+	PoolStats Stats;
+
+	void AddBlock(const unsigned int Size)
+	{
+		Block NewBlock;
+		NewBlock.Items.reset(new Storage[Size]);
+		NewBlock.Live.assign(Size, false);
+		NewBlock.Size = Size;
+
+		Blocks.push_back(std::move(NewBlock));
+
+		// Backwards, so the block is handed out from the front
+		for (unsigned int i = Size; i > 0; i--)
+			Free.push_back({ static_cast<unsigned int>(Blocks.size() - 1), i - 1 });
+
+		Stats.Capacity += Size;
+	}
+};
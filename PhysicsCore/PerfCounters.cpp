@@ -0,0 +1,109 @@
+#include "PerfCounters.h"
+
+#if defined(__linux__)
+#include <linux/perf_event.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#include <cstring>
+#endif
+
+PerfCounters::PerfCounters()
+{
+	for (int& File : Files)
+		File = -1;
+}
+
+PerfCounters::~PerfCounters()
+{
+	Close();
+}
+
+bool PerfCounters::Open()
+{
+	Close();
+
+#if defined(__linux__)
+	struct CounterConfig
+	{
+		unsigned int Type;
+		unsigned long long Config;
+	};
+
+	static const CounterConfig Configs[COUNTER_COUNT] =
+	{
+		{ PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES },
+		{ PERF_TYPE_HARDWARE, PERF_COUNT_HW_INSTRUCTIONS },
+		{ PERF_TYPE_HW_CACHE, PERF_COUNT_HW_CACHE_L1D | PERF_COUNT_HW_CACHE_OP_READ << 8 | PERF_COUNT_HW_CACHE_RESULT_MISS << 16 },
+		{ PERF_TYPE_HARDWARE, PERF_COUNT_HW_CACHE_MISSES },
+		{ PERF_TYPE_HARDWARE, PERF_COUNT_HW_BRANCH_MISSES },
+	};
+
+	for (int i = 0; i < COUNTER_COUNT; i++)
+	{
+		perf_event_attr Attributes;
+		memset(&Attributes, 0, sizeof(Attributes));
+
+		Attributes.size = sizeof(Attributes);
+		Attributes.type = Configs[i].Type;
+		Attributes.config = Configs[i].Config;
+
+		// User space only, that is where the simulation runs and it keeps perf_event_paranoid happy at level 2
+		Attributes.exclude_kernel = 1;
+		Attributes.exclude_hv = 1;
+
+		Files[i] = static_cast<int>(syscall(__NR_perf_event_open, &Attributes, 0, -1, -1, 0));
+	}
+#endif
+
+	return IsOpen();
+}
+
+void PerfCounters::Close()
+{
+	for (int& File : Files)
+	{
+#if defined(__linux__)
+		if (File >= 0)
+			close(File);
+#endif
+
+		File = -1;
+	}
+}
+
+bool PerfCounters::IsOpen() const
+{
+	for (const int File : Files)
+	{
+		if (File >= 0)
+			return true;
+	}
+
+	return false;
+}
+
+void PerfCounters::Read(unsigned long long (&OutValues)[COUNTER_COUNT]) const
+{
+	for (int i = 0; i < COUNTER_COUNT; i++)
+	{
+		OutValues[i] = 0;
+
+#if defined(__linux__)
+		if (Files[i] >= 0 && read(Files[i], &OutValues[i], sizeof(OutValues[i])) != sizeof(OutValues[i]))
+			OutValues[i] = 0;
+#endif
+	}
+}
+
+const char* PerfCounters::GetCounterName(const PerfCounter Counter)
+{
+	switch (Counter)
+	{
+	case COUNTER_CYCLES: return "Cycles";
+	case COUNTER_INSTRUCTIONS: return "Instructions";
+	case COUNTER_L1_MISSES: return "L1 misses";
+	case COUNTER_LLC_MISSES: return "LLC misses";
+	case COUNTER_BRANCH_MISSES: return "Branch misses";
+	default: return "";
+	}
+}
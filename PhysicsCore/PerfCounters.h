@@ -0,0 +1,33 @@
+#pragma once
+
+enum PerfCounter
+{
+	COUNTER_CYCLES, COUNTER_INSTRUCTIONS, COUNTER_L1_MISSES, COUNTER_LLC_MISSES, COUNTER_BRANCH_MISSES, COUNTER_COUNT
+};
+
+// Hardware counters for the calling thread, through perf_event_open. Only Linux has them,
+// and even there the kernel or a VM may refuse some or all of them, so every counter is optional
+class PerfCounters
+{
+public:
+	PerfCounters();
+	~PerfCounters();
+
+	PerfCounters(const PerfCounters&) = delete;
+	PerfCounters& operator=(const PerfCounters&) = delete;
+
+	// True if at least one counter opened
+	bool Open();
+	void Close();
+
+	bool IsOpen() const;
+	bool IsAvailable(PerfCounter Counter) const { return Files[Counter] >= 0; }
+
+	// Running totals since Open, counters that aren't available read as 0
+	void Read(unsigned long long (&OutValues)[COUNTER_COUNT]) const;
+
+	static const char* GetCounterName(PerfCounter Counter);
+
+private:
+	int Files[COUNTER_COUNT];
+};
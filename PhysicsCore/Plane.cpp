@@ -0,0 +1,66 @@
+#include "Plane.h"
+#include <glm/ext.hpp>
+
+Plane::Plane()
+{
+	DistanceToOrigin = 0;
+	Normal = { 0.0f, 1.0f };
+	LineSegment = 300.0f;
+	Velocity = {};
+
+	Shape = PLANE;
+
+	UpdateSegment();
+}
+
+Plane::Plane(const glm::vec2 Normal, const float Distance, const float LineLength)
+{
+	DistanceToOrigin = Distance;
+	this->Normal = Normal;
+	LineSegment = LineLength;
+
+	// Planes never move, the solver reads this when working out closing speeds
+	Velocity = {};
+
+	Shape = PLANE;
+
+	UpdateSegment();
+}
+
+Plane::~Plane() = default;
+
+void Plane::Debug()
+{
+}
+
+void Plane::SetNormal(const glm::vec2 Normal)
+{
+	this->Normal = Normal;
+	UpdateSegment();
+}
+
+void Plane::SetSegmentLength(const float Length)
+{
+	LineSegment = Length;
+	UpdateSegment();
+}
+
+void Plane::SetDistance(const float Distance)
+{
+	DistanceToOrigin = Distance;
+	UpdateSegment();
+}
+
+Bounds Plane::GetBounds() const
+{
+	return { glm::min(Start, End), glm::max(Start, End) };
+}
+
+void Plane::UpdateSegment()
+{
+	const glm::vec2 CenterPoint = Normal * DistanceToOrigin;
+	const glm::vec2 Parallel = { Normal.y, -Normal.x };
+
+	Start = CenterPoint + Parallel * LineSegment;
+	End = CenterPoint - Parallel * LineSegment;
+}
\ No newline at end of file
@@ -1,6 +1,5 @@
 #pragma once
 #include "Object.h"
-#include "Manifold.h"
 
 class Plane final : public Object
 {
@@ -10,25 +9,27 @@ public:
 	~Plane();
 
 	void Debug() override;
-	void MakeGizmo() override;
-
-	void ResolveCollision(Manifold* M);
-	void PositionalCorrection(Manifold* M);
+	Bounds GetBounds() const override;
 
 	float GetDistance() const { return DistanceToOrigin; }
 
+	// The ends of the segment, kept up to date whenever the plane changes so the narrowphase can use them straight away
 	glm::vec2 GetStart() const { return Start; }
 	glm::vec2 GetEnd() const { return End; }
 
-	void SetSegmentLength(const float Length) { LineSegment = Length; }
+	void SetNormal(glm::vec2 Normal);
+	void SetSegmentLength(float Length);
+	void SetDistance(float Distance);
+
+	// Overrides the ends directly, until the next change above rebuilds them
 	void SetStart(const glm::vec2 Start) { this->Start = Start; }
 	void SetEnd(const glm::vec2 End) { this->End = End; }
-
-	void SetDistance(const float Distance) { this->DistanceToOrigin = Distance; }
 private:
 	float DistanceToOrigin{};
 	float LineSegment = 300;
 
 	glm::vec2 Start{}, End{};
+
+	void UpdateSegment();
 };
 
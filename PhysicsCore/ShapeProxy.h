@@ -0,0 +1,53 @@
+#pragma once
+#include <glm/glm.hpp>
+#include <cmath>
+
+// Just the geometry of a shape, for the narrowphase kernels in Narrowphase. These are plain values, so a routine can
+// make one in local space or flip it around without building a whole Object
+
+struct CircleShape
+{
+	glm::vec2 Centre;
+	float Radius;
+};
+
+// AABBs are boxes whose axes are the world axes
+struct BoxShape
+{
+	glm::vec2 Centre;
+	glm::vec2 Axes[2];
+	glm::vec2 Extent; // Half width and half height along Axes
+
+	// Faces 0 to 3 point along +X, +Y, -X and -Y
+	glm::vec2 FaceNormal(const int Face) const { return Face < 2 ? Axes[Face] : -Axes[Face - 2]; }
+
+	// Ends of a face going anticlockwise round the box, so vertex i is where face i starts
+	void FaceVertices(const int Face, glm::vec2& Start, glm::vec2& End) const
+	{
+		const glm::vec2 Normal = FaceNormal(Face);
+		const glm::vec2 Middle = Centre + Normal * Extent[Face & 1];
+		const glm::vec2 Side = glm::vec2(-Normal.y, Normal.x) * Extent[(Face + 1) & 1];
+
+		Start = Middle - Side;
+		End = Middle + Side;
+	}
+
+	// How far the box reaches from its centre along Direction
+	float Reach(const glm::vec2 Direction) const
+	{
+		return fabsf(dot(Direction, Axes[0])) * Extent.x + fabsf(dot(Direction, Axes[1])) * Extent.y;
+	}
+
+	// Into the box's own space, where it sits at the origin with its faces on the axes
+	glm::vec2 ToLocal(const glm::vec2 Point) const { return ToLocalDirection(Point - Centre); }
+	glm::vec2 ToLocalDirection(const glm::vec2 Direction) const { return { dot(Direction, Axes[0]), dot(Direction, Axes[1]) }; }
+	glm::vec2 ToWorldDirection(const glm::vec2 Direction) const { return Axes[0] * Direction.x + Axes[1] * Direction.y; }
+};
+
+// A Plane is a segment that is solid on both sides
+struct SegmentShape
+{
+	glm::vec2 Start;
+	glm::vec2 End;
+	glm::vec2 Normal; // As the plane has it, which isn't always unit length
+};
@@ -0,0 +1,122 @@
+#include "StepProfiler.h"
+
+using Clock = std::chrono::high_resolution_clock;
+
+static float MillisecondsSince(const Clock::time_point Start)
+{
+	return std::chrono::duration<float, std::milli>(Clock::now() - Start).count();
+}
+
+void StepProfiler::BeginFrame()
+{
+	Current = StepStats();
+	FrameStart = Clock::now();
+}
+
+void StepProfiler::EndFrame()
+{
+	Current.TotalTime = MillisecondsSince(FrameStart);
+
+	History[Next] = Current;
+	Next = (Next + 1) % HISTORY_LENGTH;
+
+	if (FrameCount < HISTORY_LENGTH)
+		FrameCount++;
+}
+
+const StepStats& StepProfiler::GetFrame(const unsigned int Age) const
+{
+	return History[(Next + HISTORY_LENGTH - 1 - Age % HISTORY_LENGTH) % HISTORY_LENGTH];
+}
+
+StepStats StepProfiler::GetAverage() const
+{
+	StepStats Average;
+
+	if (FrameCount == 0)
+		return Average;
+
+	// Counters are averaged as floats and rounded down, they are only there to give a feel for the load
+	float Pairs = 0.0f, Contacts = 0.0f, Substeps = 0.0f, Awake = 0.0f;
+	unsigned long long CounterTotals[PHASE_COUNT][COUNTER_COUNT]{};
+
+	for (unsigned int Age = 0; Age < FrameCount; Age++)
+	{
+		const StepStats& Frame = GetFrame(Age);
+
+		for (int Phase = 0; Phase < PHASE_COUNT; Phase++)
+			Average.PhaseTime[Phase] += Frame.PhaseTime[Phase] / FrameCount;
+
+		Average.TotalTime += Frame.TotalTime / FrameCount;
+
+		Pairs += Frame.PairsTested;
+		Contacts += Frame.ContactsProduced;
+		Substeps += Frame.Substeps;
+		Awake += Frame.BodiesAwake;
+
+		for (int Phase = 0; Phase < PHASE_COUNT; Phase++)
+			for (int Counter = 0; Counter < COUNTER_COUNT; Counter++)
+				CounterTotals[Phase][Counter] += Frame.Counters[Phase][Counter];
+	}
+
+	Average.PairsTested = static_cast<unsigned int>(Pairs / FrameCount);
+	Average.ContactsProduced = static_cast<unsigned int>(Contacts / FrameCount);
+	Average.Substeps = static_cast<unsigned int>(Substeps / FrameCount);
+	Average.BodiesAwake = static_cast<unsigned int>(Awake / FrameCount);
+
+	for (int Phase = 0; Phase < PHASE_COUNT; Phase++)
+		for (int Counter = 0; Counter < COUNTER_COUNT; Counter++)
+			Average.Counters[Phase][Counter] = CounterTotals[Phase][Counter] / FrameCount;
+
+	return Average;
+}
+
+bool StepProfiler::SetCounters(const bool State)
+{
+	if (!State)
+	{
+		Counters.Close();
+		return true;
+	}
+
+	return Counters.Open();
+}
+
+const char* StepProfiler::GetPhaseName(const StepPhase Phase)
+{
+	switch (Phase)
+	{
+	case PHASE_INTEGRATE: return "Integrate";
+	case PHASE_CONTINUOUS: return "Continuous";
+	case PHASE_BROADPHASE: return "Broadphase";
+	case PHASE_NARROWPHASE: return "Narrowphase";
+	case PHASE_SOLVE: return "Solve";
+	case PHASE_SLEEP: return "Sleep";
+	default: return "";
+	}
+}
+
+ScopedPhaseTimer::ScopedPhaseTimer(StepProfiler& Profiler, const StepPhase Phase)
+	: Profiler(Profiler), Phase(Phase)
+{
+	// Counters first, so opening the timer doesn't land inside the phase
+	if (Profiler.Counters.IsOpen())
+		Profiler.Counters.Read(StartCounters);
+
+	Start = Clock::now();
+}
+
+ScopedPhaseTimer::~ScopedPhaseTimer()
+{
+	StepStats& Stats = Profiler.GetCurrent();
+	Stats.PhaseTime[Phase] += MillisecondsSince(Start);
+
+	if (!Profiler.Counters.IsOpen())
+		return;
+
+	unsigned long long EndCounters[COUNTER_COUNT];
+	Profiler.Counters.Read(EndCounters);
+
+	for (int Counter = 0; Counter < COUNTER_COUNT; Counter++)
+		Stats.Counters[Phase][Counter] += EndCounters[Counter] - StartCounters[Counter];
+}
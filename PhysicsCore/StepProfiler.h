@@ -0,0 +1,84 @@
+#pragma once
+#include "PerfCounters.h"
+
+#include <chrono>
+
+enum StepPhase
+{
+	PHASE_INTEGRATE, PHASE_CONTINUOUS, PHASE_BROADPHASE, PHASE_NARROWPHASE, PHASE_SOLVE, PHASE_SLEEP, PHASE_COUNT
+};
+
+// What one World::Update cost. Times are in milliseconds and add up every substep the update ran
+struct StepStats
+{
+	float PhaseTime[PHASE_COUNT]{};
+	float TotalTime{};
+
+	unsigned int PairsTested{};
+	unsigned int ContactsProduced{};
+	unsigned int Substeps{};
+	unsigned int BodiesAwake{};
+
+	// Hardware counter deltas per phase, only filled in while the profiler has counters open
+	unsigned long long Counters[PHASE_COUNT][COUNTER_COUNT]{};
+};
+
+// Keeps the stats of the last HISTORY_LENGTH updates in a ring, oldest first from GetHistoryOffset
+class StepProfiler
+{
+public:
+	static const unsigned int HISTORY_LENGTH = 240;
+
+	void BeginFrame();
+	void EndFrame();
+
+	// The update being recorded, only valid between BeginFrame and EndFrame
+	StepStats& GetCurrent() { return Current; }
+
+	// Age 0 is the last finished update
+	const StepStats& GetFrame(unsigned int Age) const;
+	unsigned int GetFrameCount() const { return FrameCount; }
+
+	// Laid out so a single field can be plotted by striding over sizeof(StepStats)
+	const StepStats* GetHistory() const { return History; }
+	unsigned int GetHistoryOffset() const { return Next; }
+
+	StepStats GetAverage() const;
+
+	// Samples hardware counters around every phase as well. Returns false if none could be opened, the timings still work either way
+	bool SetCounters(bool State);
+	bool HasCounters() const { return Counters.IsOpen(); }
+	const PerfCounters& GetCounters() const { return Counters; }
+
+	static const char* GetPhaseName(StepPhase Phase);
+
+private:
+	StepStats History[HISTORY_LENGTH]{};
+	unsigned int Next{};
+	unsigned int FrameCount{};
+
+	StepStats Current{};
+	std::chrono::high_resolution_clock::time_point FrameStart{};
+
+	PerfCounters Counters;
+
+	friend class ScopedPhaseTimer;
+};
+
+// Adds the time it was alive for to one phase of the current update
+class ScopedPhaseTimer
+{
+public:
+	ScopedPhaseTimer(StepProfiler& Profiler, StepPhase Phase);
+	~ScopedPhaseTimer();
+
+	ScopedPhaseTimer(const ScopedPhaseTimer&) = delete;
+	ScopedPhaseTimer& operator=(const ScopedPhaseTimer&) = delete;
+
+private:
+	StepProfiler& Profiler;
+	StepPhase Phase;
+	std::chrono::high_resolution_clock::time_point Start;
+
+	unsigned long long StartCounters[COUNTER_COUNT]{};
+};
@@ -0,0 +1,261 @@
+#include "SweepAndPrune.h"
+
+SweepAndPrune::SweepAndPrune() = default;
+SweepAndPrune::~SweepAndPrune() = default;
+
+void SweepAndPrune::AddActor(Object* Actor)
+{
+	if (ProxyLookup.find(Actor) != ProxyLookup.end())
+		return;
+
+	unsigned int Index;
+	if (!FreeProxies.empty())
+	{
+		Index = FreeProxies.back();
+		FreeProxies.pop_back();
+	}
+	else
+	{
+		Index = Proxies.size();
+		Proxies.emplace_back();
+	}
+
+	Proxy& NewProxy = Proxies[Index];
+	NewProxy.Actor = Actor;
+	NewProxy.Box = Actor->GetBounds();
+	NewProxy.bIsStatic = Actor->IsStatic();
+	NewProxy.bIsResting = IsResting(Actor);
+
+	// Append the endpoints, the next sort moves them into place and reports the overlaps on the way
+	for (int Axis = 0; Axis < 2; Axis++)
+	{
+		NewProxy.MinIndex[Axis] = Endpoints[Axis].size();
+		Endpoints[Axis].push_back({ NewProxy.Box.Min[Axis], Index << 1 });
+
+		NewProxy.MaxIndex[Axis] = Endpoints[Axis].size();
+		Endpoints[Axis].push_back({ NewProxy.Box.Max[Axis], (Index << 1) | 1 });
+	}
+
+	ProxyLookup[Actor] = Index;
+}
+
+void SweepAndPrune::RemoveActor(Object* Actor)
+{
+	RemoveActors({ Actor });
+}
+
+void SweepAndPrune::RemoveActors(const std::vector<Object*>& Actors)
+{
+	if (Actors.empty())
+		return;
+
+	Removing.assign(Proxies.size(), false);
+
+	bool bFound = false;
+
+	for (Object* Actor : Actors)
+	{
+		const auto FoundProxy = ProxyLookup.find(Actor);
+
+		if (FoundProxy == ProxyLookup.end())
+			continue;
+
+		Removing[FoundProxy->second] = true;
+		ProxyLookup.erase(FoundProxy);
+		bFound = true;
+	}
+
+	if (!bFound)
+		return;
+
+	// Drop every pair one of them was part of
+	for (unsigned int i = 0; i < Pairs.size();)
+	{
+		const unsigned int ProxyA = PairKeys[i] >> 32;
+		const unsigned int ProxyB = PairKeys[i] & 0xFFFFFFFF;
+
+		if (Removing[ProxyA] || Removing[ProxyB])
+			RemovePair(ProxyA, ProxyB);
+		else
+			i++;
+	}
+
+	// Close the gaps left by their endpoints, one pass per axis however many went
+	for (int Axis = 0; Axis < 2; Axis++)
+	{
+		std::vector<Endpoint>& Axes = Endpoints[Axis];
+
+		unsigned int Count = 0;
+		for (unsigned int i = 0; i < Axes.size(); i++)
+		{
+			if (Removing[Axes[i].GetProxy()])
+				continue;
+
+			Axes[Count] = Axes[i];
+			SetEndpointIndex(Axis, Count);
+			Count++;
+		}
+
+		Axes.resize(Count);
+	}
+
+	for (unsigned int Index = 0; Index < Proxies.size(); Index++)
+	{
+		if (!Removing[Index])
+			continue;
+
+		Proxies[Index].Actor = nullptr;
+		FreeProxies.push_back(Index);
+	}
+}
+
+void SweepAndPrune::FindPairs(const std::vector<Object*>&, unsigned int, std::vector<CollisionPair>& OutPairs)
+{
+	Changed.clear();
+
+	// Refresh the endpoints of the actors that moved. Sleeping and static actors only move when SetLocation is called on them
+	for (Proxy& Current : Proxies)
+	{
+		if (Current.Actor == nullptr)
+			continue;
+
+		if (Current.bIsStatic != Current.Actor->IsStatic())
+		{
+			Changed.push_back(Current.Actor);
+			continue;
+		}
+
+		if (IsStillResting(Current.Actor, Current.bIsResting))
+			continue;
+
+		const Bounds Box = Current.Actor->GetBounds();
+		Current.bIsResting = IsResting(Current.Actor);
+
+		if (Box.Min == Current.Box.Min && Box.Max == Current.Box.Max)
+			continue;
+
+		Current.Box = Box;
+
+		for (int Axis = 0; Axis < 2; Axis++)
+		{
+			Endpoints[Axis][Current.MinIndex[Axis]].Value = Box.Min[Axis];
+			Endpoints[Axis][Current.MaxIndex[Axis]].Value = Box.Max[Axis];
+		}
+	}
+
+	// Actors that became static or stopped being static are reinserted, so their pairs are found again
+	if (!Changed.empty())
+	{
+		RemoveActors(Changed);
+
+		for (Object* Actor : Changed)
+			AddActor(Actor);
+	}
+
+	SortAxis(0);
+	SortAxis(1);
+
+	// Overlaps are tracked regardless of filters and sleep, so a filter change or a body waking up takes effect on the next step
+	for (const CollisionPair& Pair : Pairs)
+	{
+		if ((IsActive(Pair.A) || IsActive(Pair.B)) && ShouldCollide(Pair.A, Pair.B))
+			OutPairs.push_back(Pair);
+	}
+}
+
+void SweepAndPrune::SortAxis(const int Axis)
+{
+	std::vector<Endpoint>& Axes = Endpoints[Axis];
+
+	for (unsigned int i = 1; i < Axes.size(); i++)
+	{
+		// Nearly sorted from the last step, so most endpoints stop straight away
+		for (unsigned int j = i; j > 0 && IsBefore(Axes[j], Axes[j - 1]); j--)
+		{
+			const Endpoint Moving = Axes[j];
+			const Endpoint Passed = Axes[j - 1];
+
+			const unsigned int MovingProxy = Moving.GetProxy();
+			const unsigned int PassedProxy = Passed.GetProxy();
+
+			// A min moving past a max means the two may have started overlapping, a max moving past a min means they stopped
+			if (!Moving.IsMax() && Passed.IsMax())
+			{
+				if (Overlaps(Proxies[MovingProxy].Box, Proxies[PassedProxy].Box))
+					AddPair(MovingProxy, PassedProxy);
+			}
+			else if (Moving.IsMax() && !Passed.IsMax())
+			{
+				RemovePair(MovingProxy, PassedProxy);
+			}
+
+			Axes[j] = Passed;
+			Axes[j - 1] = Moving;
+
+			SetEndpointIndex(Axis, j);
+			SetEndpointIndex(Axis, j - 1);
+		}
+	}
+}
+
+bool SweepAndPrune::IsBefore(const Endpoint& A, const Endpoint& B)
+{
+	// Mins go before maxes at the same value, so touching bounds count as overlapping
+	return A.Value < B.Value || (A.Value == B.Value && !A.IsMax() && B.IsMax());
+}
+
+void SweepAndPrune::SetEndpointIndex(const int Axis, const unsigned int Index)
+{
+	const Endpoint& Point = Endpoints[Axis][Index];
+	Proxy& Owner = Proxies[Point.GetProxy()];
+
+	if (Point.IsMax())
+		Owner.MaxIndex[Axis] = Index;
+	else
+		Owner.MinIndex[Axis] = Index;
+}
+
+void SweepAndPrune::AddPair(const unsigned int ProxyA, const unsigned int ProxyB)
+{
+	if (Proxies[ProxyA].bIsStatic && Proxies[ProxyB].bIsStatic)
+		return;
+
+	const unsigned long long Key = GetPairKey(ProxyA, ProxyB);
+
+	if (PairLookup.find(Key) != PairLookup.end())
+		return;
+
+	PairLookup[Key] = Pairs.size();
+	PairKeys.push_back(Key);
+	Pairs.push_back({ Proxies[Key >> 32].Actor, Proxies[Key & 0xFFFFFFFF].Actor });
+}
+
+void SweepAndPrune::RemovePair(const unsigned int ProxyA, const unsigned int ProxyB)
+{
+	const auto FoundPair = PairLookup.find(GetPairKey(ProxyA, ProxyB));
+
+	if (FoundPair == PairLookup.end())
+		return;
+
+	// Swap the last pair into the hole
+	const unsigned int Index = FoundPair->second;
+	PairLookup.erase(FoundPair);
+
+	if (Index != Pairs.size() - 1)
+	{
+		Pairs[Index] = Pairs.back();
+		PairKeys[Index] = PairKeys.back();
+		PairLookup[PairKeys[Index]] = Index;
+	}
+
+	Pairs.pop_back();
+	PairKeys.pop_back();
+}
+
+unsigned long long SweepAndPrune::GetPairKey(const unsigned int ProxyA, const unsigned int ProxyB)
+{
+	const unsigned long long Low = ProxyA < ProxyB ? ProxyA : ProxyB;
+	const unsigned long long High = ProxyA < ProxyB ? ProxyB : ProxyA;
+
+	return Low << 32 | High;
+}
@@ -0,0 +1,64 @@
+#pragma once
+#include "Broadphase.h"
+
+#include <unordered_map>
+
+// Keeps the min/max endpoints of every actor sorted along both axes across steps.
+// Actors that did not move keep their place, so the insertion sort only does work for the ones that did,
+// and the overlapping pairs are only added or removed when two endpoints swap
+class SweepAndPrune final : public Broadphase
+{
+public:
+	SweepAndPrune();
+	~SweepAndPrune();
+
+	void AddActor(Object* Actor) override;
+	void RemoveActor(Object* Actor) override;
+	void RemoveActors(const std::vector<Object*>& Actors) override;
+
+	void FindPairs(const std::vector<Object*>& Actors, unsigned int DynamicCount, std::vector<CollisionPair>& OutPairs) override;
+
+	const std::vector<CollisionPair>& GetPairs() const { return Pairs; }
+
+private:
+	struct Proxy
+	{
+		Object* Actor;
+		Bounds Box;
+		bool bIsStatic; // Static proxies are never paired with each other
+		bool bIsResting; // Box was read while the actor was asleep or static, see Broadphase::IsResting
+		unsigned int MinIndex[2], MaxIndex[2]; // Where the endpoints currently sit in each axis
+	};
+
+	struct Endpoint
+	{
+		float Value;
+		unsigned int Data; // Proxy index shifted left by one, lowest bit set for max endpoints
+
+		unsigned int GetProxy() const { return Data >> 1; }
+		bool IsMax() const { return (Data & 1) != 0; }
+	};
+
+	std::vector<Proxy> Proxies;
+	std::vector<unsigned int> FreeProxies;
+	std::unordered_map<Object*, unsigned int> ProxyLookup;
+	std::vector<Object*> Changed;
+	std::vector<bool> Removing;
+
+	std::vector<Endpoint> Endpoints[2];
+
+	// The overlapping pairs, kept densely packed so they can be handed over in one go
+	std::vector<CollisionPair> Pairs;
+	std::vector<unsigned long long> PairKeys;
+	std::unordered_map<unsigned long long, unsigned int> PairLookup;
+
+	void SortAxis(int Axis);
+	static bool IsBefore(const Endpoint& A, const Endpoint& B);
+	void SetEndpointIndex(int Axis, unsigned int Index);
+
+	void AddPair(unsigned int ProxyA, unsigned int ProxyB);
+	void RemovePair(unsigned int ProxyA, unsigned int ProxyB);
+
+	static unsigned long long GetPairKey(unsigned int ProxyA, unsigned int ProxyB);
+};
+
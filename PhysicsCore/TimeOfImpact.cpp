@@ -0,0 +1,159 @@
+#include "TimeOfImpact.h"
+
+#include <glm/glm.hpp>
+#include <cfloat>
+#include <cmath>
+
+bool TimeOfImpact::CircleToCircle(const glm::vec2 Start, const glm::vec2 Motion, const float Radius, const glm::vec2 Centre, const float OtherRadius, ImpactResult& Out)
+{
+	// Solve |Offset + Motion * t| = Radius + OtherRadius for the first t
+	const glm::vec2 Offset = Start - Centre;
+	const float Reach = Radius + OtherRadius;
+
+	const float A = dot(Motion, Motion);
+	const float B = dot(Offset, Motion);
+	const float C = dot(Offset, Offset) - Reach * Reach;
+
+	// Already touching, or moving away
+	if (C <= 0.0f || B >= 0.0f || A <= 0.0f)
+		return false;
+
+	const float Discriminant = B * B - A * C;
+
+	if (Discriminant < 0.0f)
+		return false;
+
+	const float t = (-B - sqrtf(Discriminant)) / A;
+
+	if (t > 1.0f)
+		return false;
+
+	Out.Fraction = t;
+	Out.Normal = normalize(Offset + Motion * t);
+
+	return true;
+}
+
+bool TimeOfImpact::CircleToSegment(const glm::vec2 Start, const glm::vec2 Motion, const float Radius, const glm::vec2 SegmentStart, const glm::vec2 SegmentEnd, ImpactResult& Out)
+{
+	const glm::vec2 Segment = SegmentEnd - SegmentStart;
+	const float LengthSquared = dot(Segment, Segment);
+
+	if (LengthSquared <= 0.0f)
+		return CircleToCircle(Start, Motion, Radius, SegmentStart, 0.0f, Out);
+
+	const glm::vec2 Normal = glm::vec2(-Segment.y, Segment.x) / sqrtf(LengthSquared);
+
+	// Distance from the line at both ends of the motion
+	const float StartDistance = dot(Start - SegmentStart, Normal);
+	const float EndDistance = StartDistance + dot(Motion, Normal);
+	const float Side = StartDistance >= 0.0f ? 1.0f : -1.0f;
+
+	// Never gets within reach of the line, so it can't reach the ends either
+	if (Side * EndDistance >= Radius && fabsf(StartDistance) >= Radius)
+		return false;
+
+	if (fabsf(StartDistance) >= Radius)
+	{
+		const float t = (StartDistance - Side * Radius) / (StartDistance - EndDistance);
+		const float Along = dot(Start + Motion * t - SegmentStart, Segment) / LengthSquared;
+
+		if (Along >= 0.0f && Along <= 1.0f)
+		{
+			Out.Fraction = t;
+			Out.Normal = Normal * Side;
+
+			return true;
+		}
+	}
+	else
+	{
+		const float Along = dot(Start - SegmentStart, Segment) / LengthSquared;
+
+		// Alongside the segment and within reach, it is already touching
+		if (Along >= 0.0f && Along <= 1.0f)
+			return false;
+	}
+
+	// Past the end of the flat part, only the end points can be hit
+	ImpactResult First, Second;
+	const bool bHitStart = CircleToCircle(Start, Motion, Radius, SegmentStart, 0.0f, First);
+	const bool bHitEnd = CircleToCircle(Start, Motion, Radius, SegmentEnd, 0.0f, Second);
+
+	if (!bHitStart && !bHitEnd)
+		return false;
+
+	Out = !bHitEnd || (bHitStart && First.Fraction < Second.Fraction) ? First : Second;
+
+	return true;
+}
+
+bool TimeOfImpact::CircleToBox(const glm::vec2 Start, const glm::vec2 Motion, const float Radius, const glm::vec2 Centre, const glm::vec2 Extent, const glm::vec2 AxisX, const glm::vec2 AxisY, ImpactResult& Out)
+{
+	// Work in the box's own space, where it is an AABB at the origin
+	const glm::vec2 Offset = Start - Centre;
+	const glm::vec2 LocalStart = { dot(Offset, AxisX), dot(Offset, AxisY) };
+	const glm::vec2 LocalMotion = { dot(Motion, AxisX), dot(Motion, AxisY) };
+
+	const glm::vec2 Closest = clamp(LocalStart, -Extent, Extent);
+
+	if (dot(LocalStart - Closest, LocalStart - Closest) <= Radius * Radius)
+		return false;
+
+	// Ray against the box grown by the radius, its corners are squared off here and rounded below
+	const glm::vec2 Grown = Extent + Radius;
+
+	float tmin = -FLT_MAX;
+	float tmax = FLT_MAX;
+	int EntryAxis = 0;
+
+	for (int Axis = 0; Axis < 2; Axis++)
+	{
+		if (LocalMotion.AsArray[Axis] == 0.0f)
+		{
+			if (fabsf(LocalStart.AsArray[Axis]) > Grown.AsArray[Axis])
+				return false;
+
+			continue;
+		}
+
+		const float InverseMotion = 1.0f / LocalMotion.AsArray[Axis];
+		const float Near = (-Grown.AsArray[Axis] - LocalStart.AsArray[Axis]) * InverseMotion;
+		const float Far = (Grown.AsArray[Axis] - LocalStart.AsArray[Axis]) * InverseMotion;
+
+		if (fminf(Near, Far) > tmin)
+		{
+			tmin = fminf(Near, Far);
+			EntryAxis = Axis;
+		}
+
+		tmax = fminf(tmax, fmaxf(Near, Far));
+	}
+
+	if (tmin > tmax || tmax < 0.0f || tmin > 1.0f)
+		return false;
+
+	ImpactResult Local;
+
+	// Starting inside the squared off corner means only the rounded corner can be hit
+	const glm::vec2 Entry = LocalStart + LocalMotion * fmaxf(tmin, 0.0f);
+
+	if (tmin < 0.0f || (fabsf(Entry.x) > Extent.x && fabsf(Entry.y) > Extent.y))
+	{
+		const glm::vec2 Corner = { Entry.x < 0.0f ? -Extent.x : Extent.x, Entry.y < 0.0f ? -Extent.y : Extent.y };
+
+		if (!CircleToCircle(LocalStart, LocalMotion, Radius, Corner, 0.0f, Local))
+			return false;
+	}
+	else
+	{
+		Local.Fraction = tmin;
+		Local.Normal = {};
+		Local.Normal.AsArray[EntryAxis] = LocalMotion.AsArray[EntryAxis] > 0.0f ? -1.0f : 1.0f;
+	}
+
+	Out.Fraction = Local.Fraction;
+	Out.Normal = AxisX * Local.Normal.x + AxisY * Local.Normal.y;
+
+	return true;
+}
@@ -0,0 +1,23 @@
+#pragma once
+#include <glm/vec2.hpp>
+
+// Where along its motion a moving circle first touches something that stays put
+struct ImpactResult
+{
+	float Fraction{1.0f}; // 0 at the start of the motion, 1 at the end
+	glm::vec2 Normal{}; // Points from the shape towards the circle
+};
+
+// Swept tests for fast circles against shapes that don't move during the sweep. Each returns false if the circle
+// starts out already touching, the narrowphase deals with that, or if it doesn't reach the shape within Motion
+class TimeOfImpact
+{
+public:
+	static bool CircleToCircle(glm::vec2 Start, glm::vec2 Motion, float Radius, glm::vec2 Centre, float OtherRadius, ImpactResult& Out);
+
+	// Both sides of the segment are solid, like a Plane
+	static bool CircleToSegment(glm::vec2 Start, glm::vec2 Motion, float Radius, glm::vec2 SegmentStart, glm::vec2 SegmentEnd, ImpactResult& Out);
+
+	// AxisX and AxisY are the box's unit axes in world space, AABBs pass the world axes
+	static bool CircleToBox(glm::vec2 Start, glm::vec2 Motion, float Radius, glm::vec2 Centre, glm::vec2 Extent, glm::vec2 AxisX, glm::vec2 AxisY, ImpactResult& Out);
+};
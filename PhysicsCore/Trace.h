@@ -0,0 +1,135 @@
+#pragma once
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+// Scoped trace zones that can be written out as a Chrome trace event file, for chrome://tracing or Perfetto.
+// Header only so the bootstrap can place zones without linking against the physics. Define PHYSICS_NO_TRACE to compile every zone out,
+// the Release configurations of the Visual Studio projects do
+
+struct TraceEvent
+{
+	const char* Name; // Has to outlive the trace, zones are named with literals
+	long long Start, Duration; // Nanoseconds since the first event
+};
+
+// Every thread records into its own ring, so recording never waits on another thread
+struct TraceBuffer
+{
+	static const unsigned int CAPACITY = 1 << 16;
+
+	TraceEvent Events[CAPACITY];
+	std::atomic<unsigned long long> Written{0};
+	unsigned int ThreadId{};
+};
+
+class Tracer
+{
+public:
+	static long long Now()
+	{
+		static const std::chrono::steady_clock::time_point Epoch = std::chrono::steady_clock::now();
+		return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - Epoch).count();
+	}
+
+	static void Record(const char* Name, const long long Start, const long long End)
+	{
+		TraceBuffer& Buffer = GetThreadBuffer();
+
+		const unsigned long long Index = Buffer.Written.load(std::memory_order_relaxed);
+		Buffer.Events[Index % TraceBuffer::CAPACITY] = { Name, Start, End - Start };
+		Buffer.Written.store(Index + 1, std::memory_order_release);
+	}
+
+	// Writes the newest CAPACITY events of every thread. Best called between frames,
+	// a thread that is still recording can overwrite its oldest events while they are being copied
+	static bool WriteChromeTrace(const char* Path)
+	{
+		FILE* File = fopen(Path, "w");
+
+		if (File == nullptr)
+			return false;
+
+		fprintf(File, "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[");
+
+		bool bFirst = true;
+		Registry& Threads = GetRegistry();
+		std::lock_guard<std::mutex> Guard(Threads.Lock);
+
+		for (const std::unique_ptr<TraceBuffer>& Buffer : Threads.Buffers)
+		{
+			const unsigned long long Written = Buffer->Written.load(std::memory_order_acquire);
+			const unsigned long long First = Written > TraceBuffer::CAPACITY ? Written - TraceBuffer::CAPACITY : 0;
+
+			for (unsigned long long i = First; i < Written; i++)
+			{
+				const TraceEvent& Event = Buffer->Events[i % TraceBuffer::CAPACITY];
+
+				fprintf(File, "%s\n{\"name\":\"%s\",\"ph\":\"X\",\"pid\":0,\"tid\":%u,\"ts\":%.3f,\"dur\":%.3f}", bFirst ? "" : ",",
+					Event.Name, Buffer->ThreadId, Event.Start / 1000.0, Event.Duration / 1000.0);
+
+				bFirst = false;
+			}
+		}
+
+		fprintf(File, "\n]}\n");
+		return fclose(File) == 0;
+	}
+
+private:
+	struct Registry
+	{
+		std::mutex Lock;
+		std::vector<std::unique_ptr<TraceBuffer>> Buffers; // Kept after their thread exits so its events still get written
+	};
+
+	static Registry& GetRegistry()
+	{
+		static Registry Threads;
+		return Threads;
+	}
+
+	static TraceBuffer& GetThreadBuffer()
+	{
+		// Only the first event on each thread takes the lock
+		thread_local TraceBuffer* Buffer = Register();
+		return *Buffer;
+	}
+
+	static TraceBuffer* Register()
+	{
+		Registry& Threads = GetRegistry();
+		std::lock_guard<std::mutex> Guard(Threads.Lock);
+
+		Threads.Buffers.emplace_back(new TraceBuffer());
+		Threads.Buffers.back()->ThreadId = Threads.Buffers.size() - 1;
+
+		return Threads.Buffers.back().get();
+	}
+};
+
+class TraceZone
+{
+public:
+	explicit TraceZone(const char* Name) : Name(Name), Start(Tracer::Now()) {}
+	~TraceZone() { Tracer::Record(Name, Start, Tracer::Now()); }
+
+	TraceZone(const TraceZone&) = delete;
+	TraceZone& operator=(const TraceZone&) = delete;
+
+private:
+	const char* Name;
+	long long Start;
+};
+
+#define TRACE_CONCAT_INNER(A, B) A##B
+#define TRACE_CONCAT(A, B) TRACE_CONCAT_INNER(A, B)
+
+#ifndef PHYSICS_NO_TRACE
+#define TRACE_ZONE(Name) TraceZone TRACE_CONCAT(Zone, __LINE__)(Name)
+#else
+#define TRACE_ZONE(Name)
+#endif
@@ -0,0 +1,145 @@
+#include "TreeBroadphase.h"
+
+TreeBroadphase::TreeBroadphase()
+{
+	// Static leaves are never moved, so there is no point in fattening them
+	StaticTree.SetMargin(0.0f);
+}
+
+TreeBroadphase::~TreeBroadphase() = default;
+
+void TreeBroadphase::AddActor(Object* Actor)
+{
+	if (EntryLookup.find(Actor) != EntryLookup.end())
+		return;
+
+	int Index;
+	if (!FreeEntries.empty())
+	{
+		Index = FreeEntries.back();
+		FreeEntries.pop_back();
+	}
+	else
+	{
+		Index = Entries.size();
+		Entries.emplace_back();
+	}
+
+	Entries[Index].Actor = Actor;
+	InsertEntry(Index);
+
+	EntryLookup[Actor] = Index;
+}
+
+void TreeBroadphase::RemoveActor(Object* Actor)
+{
+	const auto FoundEntry = EntryLookup.find(Actor);
+
+	if (FoundEntry == EntryLookup.end())
+		return;
+
+	RemoveEntry(FoundEntry->second);
+
+	Entries[FoundEntry->second].Actor = nullptr;
+	FreeEntries.push_back(FoundEntry->second);
+
+	EntryLookup.erase(FoundEntry);
+}
+
+void TreeBroadphase::FindPairs(const std::vector<Object*>&, unsigned int, std::vector<CollisionPair>& OutPairs)
+{
+	// Move the leaves, and switch trees for anything that became static or stopped being static
+	for (int i = 0; i < static_cast<int>(Entries.size()); i++)
+	{
+		Entry& Current = Entries[i];
+
+		if (Current.Actor == nullptr)
+			continue;
+
+		if (Current.bIsStatic != Current.Actor->IsStatic())
+		{
+			RemoveEntry(i);
+			InsertEntry(i);
+			continue;
+		}
+
+		Current.bIsActive = !Current.bIsStatic && IsActive(Current.Actor);
+
+		// Sleeping and static actors only move when something calls SetLocation on them, like the launcher does with the Ball
+		if (IsStillResting(Current.Actor, Current.bIsResting))
+			continue;
+
+		Current.Box = Current.Actor->GetBounds();
+		Current.bIsResting = IsResting(Current.Actor);
+
+		DynamicTree& Tree = Current.bIsStatic ? StaticTree : MovingTree;
+		Tree.MoveProxy(Current.Proxy, Current.Box);
+	}
+
+	// Only active actors look for partners, sleeping and static actors never pair up with each other
+	for (int i = 0; i < static_cast<int>(Entries.size()); i++)
+	{
+		const Entry& Current = Entries[i];
+
+		if (Current.Actor == nullptr || !Current.bIsActive)
+			continue;
+
+		MovingTree.Query(Current.Box, [&](const int Other)
+		{
+			// A pair of active actors is found from both sides, keep the one from the lower entry
+			if ((Other > i || !Entries[Other].bIsActive) && Overlaps(Current.Box, Entries[Other].Box) && ShouldCollide(Current.Actor, Entries[Other].Actor))
+				OutPairs.push_back({ Current.Actor, Entries[Other].Actor });
+
+			return true;
+		});
+
+		StaticTree.Query(Current.Box, [&](const int Other)
+		{
+			if (Overlaps(Current.Box, Entries[Other].Box) && ShouldCollide(Current.Actor, Entries[Other].Actor))
+				OutPairs.push_back({ Current.Actor, Entries[Other].Actor });
+
+			return true;
+		});
+	}
+}
+
+void TreeBroadphase::QueryRegion(const Bounds& Region, std::vector<Object*>& OutActors) const
+{
+	const auto Collect = [&](const int Index)
+	{
+		if (Overlaps(Region, Entries[Index].Box))
+			OutActors.push_back(Entries[Index].Actor);
+
+		return true;
+	};
+
+	StaticTree.Query(Region, Collect);
+	MovingTree.Query(Region, Collect);
+}
+
+void TreeBroadphase::SetMargin(const float Margin)
+{
+	// Only affects leaves inserted from now on
+	MovingTree.SetMargin(Margin);
+}
+
+void TreeBroadphase::InsertEntry(const int Index)
+{
+	Entry& Current = Entries[Index];
+
+	Current.Box = Current.Actor->GetBounds();
+	Current.bIsStatic = Current.Actor->IsStatic();
+	Current.bIsResting = IsResting(Current.Actor);
+	Current.bIsActive = !Current.bIsStatic && IsActive(Current.Actor);
+
+	DynamicTree& Tree = Current.bIsStatic ? StaticTree : MovingTree;
+	Current.Proxy = Tree.CreateProxy(Current.Box, Index);
+}
+
+void TreeBroadphase::RemoveEntry(const int Index)
+{
+	const Entry& Current = Entries[Index];
+
+	DynamicTree& Tree = Current.bIsStatic ? StaticTree : MovingTree;
+	Tree.DestroyProxy(Current.Proxy);
+}
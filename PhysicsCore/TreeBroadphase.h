@@ -0,0 +1,49 @@
+#pragma once
+#include "Broadphase.h"
+#include "DynamicTree.h"
+
+#include <unordered_map>
+
+// Keeps kinematic actors and moving actors in two separate trees. The static tree is only touched when a kinematic actor
+// is moved by hand, moving actors are only reinserted once they leave their fat bounds
+class TreeBroadphase final : public Broadphase
+{
+public:
+	TreeBroadphase();
+	~TreeBroadphase();
+
+	void AddActor(Object* Actor) override;
+	void RemoveActor(Object* Actor) override;
+
+	void FindPairs(const std::vector<Object*>& Actors, unsigned int DynamicCount, std::vector<CollisionPair>& OutPairs) override;
+
+	// Every actor whose bounds overlap the region
+	void QueryRegion(const Bounds& Region, std::vector<Object*>& OutActors) const;
+
+	void SetMargin(float Margin);
+
+	const DynamicTree& GetStaticTree() const { return StaticTree; }
+	const DynamicTree& GetDynamicTree() const { return MovingTree; }
+
+private:
+	struct Entry
+	{
+		Object* Actor;
+		Bounds Box;
+		int Proxy;
+		bool bIsStatic;
+		bool bIsResting; // Box was read while the actor was asleep or static, see Broadphase::IsResting
+		bool bIsActive; // This step, see Broadphase::IsActive
+	};
+
+	DynamicTree StaticTree;
+	DynamicTree MovingTree;
+
+	std::vector<Entry> Entries;
+	std::vector<int> FreeEntries;
+	std::unordered_map<Object*, int> EntryLookup;
+
+	void InsertEntry(int Index);
+	void RemoveEntry(int Index);
+};
+
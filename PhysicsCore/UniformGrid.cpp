@@ -0,0 +1,143 @@
+#include "UniformGrid.h"
+
+#include <glm/ext.hpp>
+
+UniformGrid::UniformGrid(const float CellSize, const glm::vec2 Min, const glm::vec2 Max)
+{
+	this->Min = Min;
+	this->Max = Max;
+
+	SetCellSize(CellSize);
+}
+
+UniformGrid::~UniformGrid() = default;
+
+void UniformGrid::SetCellSize(const float CellSize)
+{
+	this->CellSize = glm::max(CellSize, 0.01f);
+
+	Columns = glm::max(static_cast<int>(ceilf((Max.x - Min.x) / this->CellSize)), 1);
+	Rows = glm::max(static_cast<int>(ceilf((Max.y - Min.y) / this->CellSize)), 1);
+
+	CellStart.assign(Columns * Rows + 1, 0);
+}
+
+void UniformGrid::SetRegion(const glm::vec2 Min, const glm::vec2 Max)
+{
+	this->Min = Min;
+	this->Max = Max;
+
+	SetCellSize(CellSize);
+}
+
+void UniformGrid::FindPairs(const std::vector<Object*>& Actors, const unsigned int DynamicCount, std::vector<CollisionPair>& OutPairs)
+{
+	const unsigned int ActorCount = Actors.size();
+
+	ActorBounds.resize(ActorCount);
+	ActorCells.resize(ActorCount);
+	BoundsOwners.resize(ActorCount, nullptr);
+	bBoundsResting.resize(ActorCount, 0);
+	bActorActive.resize(ActorCount);
+
+	// Count how many actors land in each cell
+	std::fill(CellStart.begin(), CellStart.end(), 0);
+
+	for (unsigned int i = 0; i < ActorCount; i++)
+	{
+		// Removals and swaps move actors around the list, so the cached bounds only count if they are still the same actor's
+		if (BoundsOwners[i] != Actors[i] || !IsStillResting(Actors[i], bBoundsResting[i] != 0))
+		{
+			const Bounds Box = Actors[i]->GetBounds();
+
+			ActorBounds[i] = Box;
+			ActorCells[i] = { GetCellX(Box.Min.x), GetCellY(Box.Min.y), GetCellX(Box.Max.x), GetCellY(Box.Max.y) };
+			BoundsOwners[i] = Actors[i];
+			bBoundsResting[i] = IsResting(Actors[i]);
+		}
+
+		bActorActive[i] = i < DynamicCount && IsActive(Actors[i]);
+
+		const CellRange& Range = ActorCells[i];
+
+		for (int y = Range.MinY; y <= Range.MaxY; y++)
+			for (int x = Range.MinX; x <= Range.MaxX; x++)
+				CellStart[y * Columns + x + 1]++;
+	}
+
+	// Turn the counts into offsets
+	for (unsigned int i = 1; i < CellStart.size(); i++)
+		CellStart[i] += CellStart[i - 1];
+
+	CellEntries.resize(CellStart.back());
+
+	// Fill the cells, actors end up in ascending order inside every cell
+	CellCursor.assign(CellStart.begin(), CellStart.end() - 1);
+
+	for (unsigned int i = 0; i < ActorCount; i++)
+	{
+		const CellRange& Range = ActorCells[i];
+
+		for (int y = Range.MinY; y <= Range.MaxY; y++)
+			for (int x = Range.MinX; x <= Range.MaxX; x++)
+				CellEntries[CellCursor[y * Columns + x]++] = i;
+	}
+
+	// Pair up everything sharing a cell, as long as one of the two is active
+	for (int Cell = 0; Cell < Columns * Rows; Cell++)
+	{
+		const unsigned int First = CellStart[Cell];
+		const unsigned int Last = CellStart[Cell + 1];
+
+		for (unsigned int Outer = First; Outer + 1 < Last; Outer++)
+		{
+			const unsigned int i = CellEntries[Outer];
+
+			// Everything after a static actor is static as well
+			if (i >= DynamicCount)
+				break;
+
+			const bool bActive = bActorActive[i] != 0;
+
+			for (unsigned int Inner = Outer + 1; Inner < Last; Inner++)
+			{
+				const unsigned int j = CellEntries[Inner];
+
+				// A resting actor only pairs with active ones, and none of the static actors at the end are
+				if (!bActive)
+				{
+					if (j >= DynamicCount)
+						break;
+
+					if (!bActorActive[j])
+						continue;
+				}
+
+				if (!Overlaps(ActorBounds[i], ActorBounds[j]))
+					continue;
+
+				// Two actors can share many cells, only report them from the cell holding the corner of their overlap
+				const int OverlapX = glm::max(ActorCells[i].MinX, ActorCells[j].MinX);
+				const int OverlapY = glm::max(ActorCells[i].MinY, ActorCells[j].MinY);
+
+				if (OverlapY * Columns + OverlapX != Cell)
+					continue;
+
+				if (!ShouldCollide(Actors[i], Actors[j]))
+					continue;
+
+				OutPairs.push_back({ Actors[i], Actors[j] });
+			}
+		}
+	}
+}
+
+int UniformGrid::GetCellX(const float X) const
+{
+	return glm::clamp(static_cast<int>(floorf((X - Min.x) / CellSize)), 0, Columns - 1);
+}
+
+int UniformGrid::GetCellY(const float Y) const
+{
+	return glm::clamp(static_cast<int>(floorf((Y - Min.y) / CellSize)), 0, Rows - 1);
+}
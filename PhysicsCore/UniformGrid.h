@@ -0,0 +1,51 @@
+#pragma once
+#include "Broadphase.h"
+
+#include <glm/vec2.hpp>
+
+// Buckets actors into fixed size cells every step. Only actors that share a cell are paired up
+class UniformGrid final : public Broadphase
+{
+public:
+	UniformGrid(float CellSize, glm::vec2 Min, glm::vec2 Max);
+	~UniformGrid();
+
+	void FindPairs(const std::vector<Object*>& Actors, unsigned int DynamicCount, std::vector<CollisionPair>& OutPairs) override;
+
+	void SetCellSize(float CellSize);
+	float GetCellSize() const { return CellSize; }
+
+	void SetRegion(glm::vec2 Min, glm::vec2 Max);
+
+private:
+	struct CellRange
+	{
+		int MinX, MinY, MaxX, MaxY;
+	};
+
+	float CellSize{};
+
+	// The region covered by the grid. Anything outside of it is clamped into the border cells
+	glm::vec2 Min{}, Max{};
+
+	int Columns{}, Rows{};
+
+	std::vector<Bounds> ActorBounds;
+	std::vector<CellRange> ActorCells;
+
+	// Who each entry of ActorBounds was read from and whether it was resting then, so resting actors skip GetBounds
+	std::vector<Object*> BoundsOwners;
+	std::vector<unsigned char> bBoundsResting;
+
+	// Awake and moving this step, see Broadphase::IsActive
+	std::vector<unsigned char> bActorActive;
+
+	// Actor indices sorted by cell, CellStart[i] is the first entry of cell i
+	std::vector<unsigned int> CellStart;
+	std::vector<unsigned int> CellEntries;
+	std::vector<unsigned int> CellCursor;
+
+	int GetCellX(float X) const;
+	int GetCellY(float Y) const;
+};
+
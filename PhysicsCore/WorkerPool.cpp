@@ -0,0 +1,79 @@
+#include "WorkerPool.h"
+
+WorkerPool::WorkerPool(const unsigned int ThreadCount)
+{
+	for (unsigned int i = 1; i < ThreadCount; i++)
+		Threads.emplace_back(&WorkerPool::WorkerLoop, this);
+}
+
+WorkerPool::~WorkerPool()
+{
+	{
+		std::lock_guard<std::mutex> Guard(Lock);
+		bShuttingDown = true;
+	}
+
+	WorkReady.notify_all();
+
+	for (std::thread& Thread : Threads)
+		Thread.join();
+}
+
+void WorkerPool::Run(const unsigned int JobCount, const std::function<void(unsigned int)>& Job)
+{
+	{
+		std::lock_guard<std::mutex> Guard(Lock);
+		this->Job = &Job;
+		this->JobCount = JobCount;
+		NextJob = 0;
+		Busy = Threads.size();
+		Generation++;
+	}
+
+	WorkReady.notify_all();
+
+	RunJobs();
+
+	std::unique_lock<std::mutex> Guard(Lock);
+	WorkDone.wait(Guard, [this] { return Busy == 0; });
+
+	this->Job = nullptr;
+}
+
+void WorkerPool::WorkerLoop()
+{
+	unsigned int LastGeneration = 0;
+
+	while (true)
+	{
+		{
+			std::unique_lock<std::mutex> Guard(Lock);
+			WorkReady.wait(Guard, [&] { return bShuttingDown || Generation != LastGeneration; });
+
+			if (bShuttingDown)
+				return;
+
+			LastGeneration = Generation;
+		}
+
+		RunJobs();
+
+		std::lock_guard<std::mutex> Guard(Lock);
+
+		if (--Busy == 0)
+			WorkDone.notify_one();
+	}
+}
+
+void WorkerPool::RunJobs()
+{
+	while (true)
+	{
+		const unsigned int Index = NextJob++;
+
+		if (Index >= JobCount)
+			return;
+
+		(*Job)(Index);
+	}
+}
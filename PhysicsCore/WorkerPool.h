@@ -0,0 +1,45 @@
+#pragma once
+#include <atomic>
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+// A fixed set of threads that run numbered jobs. The thread calling Run works too, so a pool of N runs N jobs at once
+class WorkerPool
+{
+public:
+	explicit WorkerPool(unsigned int ThreadCount);
+	~WorkerPool();
+
+	// Calls Job(0) to Job(JobCount - 1) across the threads, returns once every job has finished
+	void Run(unsigned int JobCount, const std::function<void(unsigned int)>& Job);
+
+	unsigned int GetThreadCount() const { return Threads.size() + 1; }
+
+private:
+	void WorkerLoop();
+
+	// Takes jobs until there are none left
+	void RunJobs();
+
+	std::vector<std::thread> Threads;
+
+	std::mutex Lock;
+	std::condition_variable WorkReady;
+	std::condition_variable WorkDone;
+
+	const std::function<void(unsigned int)>* Job{};
+	unsigned int JobCount{};
+	std::atomic<unsigned int> NextJob{};
+
+	// Workers still busy with the current Run
+	unsigned int Busy{};
+
+	// Bumped by every Run so sleeping workers can tell there is new work
+	unsigned int Generation{};
+
+	bool bShuttingDown{false};
+};
+
@@ -0,0 +1,801 @@
+﻿#include "World.h"
+#include "AABB.h"
+#include "Circle.h"
+
+#include <glm/ext.hpp>
+#include "Plane.h"
+#include <cfloat>
+#include "OBB.h"
+#include "Narrowphase.h"
+#include "UniformGrid.h"
+#include "SweepAndPrune.h"
+#include "TreeBroadphase.h"
+#include "Trace.h"
+
+// Chunks smaller than this cost more to hand out than they save
+static const unsigned int MIN_PAIRS_PER_CHUNK = 64;
+
+// Gap left between a bullet and what it hit, so it doesn't start the next sweep already touching
+static const float BULLET_SKIN = 0.01f;
+
+// Pairs the narrowphase buckets by shape at a time. Small enough that their bodies are still in cache when the routines run
+static const unsigned int NARROWPHASE_BATCH_SIZE = 256;
+
+// Marks a pair in NarrowphaseChunk::ManifoldOf that didn't touch
+static const unsigned int NO_MANIFOLD = 0xFFFFFFFF;
+
+// Bounces a bullet may make in one step before it waits for the next
+static const int MAX_BULLET_IMPACTS = 4;
+
+World::World()
+{
+	Integration = Integrator::DetectPath();
+	CircleBatchPath = Integration;
+
+	SetBroadphase(Method);
+}
+
+World::~World()
+{
+	// Actors the caller made outlive the World. Hand them their state back like FlushRemovals does, so their getters
+	// don't read from the store once it is gone. Taking them from the end never moves anything else
+	while (Bodies.GetCount() > 0)
+		Bodies.Remove(Bodies.GetCount() - 1);
+
+	delete PairFinder;
+	delete Workers;
+}
+
+typedef bool(*CollisionFn)(Manifold*);
+
+// Runs a routine written for the opposite argument order, then hands the manifold back the way it came in
+template <CollisionFn Routine>
+static bool Flipped(Manifold* M)
+{
+	std::swap(M->A, M->B);
+
+	const bool Collided = Routine(M);
+
+	std::swap(M->A, M->B);
+	M->Normal *= -1.0f;
+
+	return Collided;
+}
+
+// Indexed by [Shape of A][Shape of B]. Every pair of shapes has exactly one routine, the other order goes through Flipped
+static CollisionFn CollisionFunctionArray[LAST][LAST] =
+{
+	//	AABB							OBB								CIRCLE							PLANE
+	{	World::AABBToAABB,				Flipped<World::OBBToAABB>,		World::AABBToCircle,			Flipped<World::PlaneToAABB>		},	// AABB
+	{	World::OBBToAABB,				World::OBBToOBB,				World::OBBToCircle,				Flipped<World::PlaneToOBB>		},	// OBB
+	{	Flipped<World::AABBToCircle>,	Flipped<World::OBBToCircle>,	World::CircleToCircle,			Flipped<World::PlaneToCircle>	},	// CIRCLE
+	{	World::PlaneToAABB,				World::PlaneToOBB,				World::PlaneToCircle,			World::PlaneToPlane				}	// PLANE
+};
+
+// The trace zone each entry of CollisionFunctionArray runs under, named after the routine that does the work
+static const char* const CollisionZoneNames[LAST][LAST] =
+{
+	{	"World::AABBToAABB",	"World::OBBToAABB",		"World::AABBToCircle",		"World::PlaneToAABB"	},
+	{	"World::OBBToAABB",		"World::OBBToOBB",		"World::OBBToCircle",		"World::PlaneToOBB"		},
+	{	"World::AABBToCircle",	"World::OBBToCircle",	"World::CircleToCircle",	"World::PlaneToCircle"	},
+	{	"World::PlaneToAABB",	"World::PlaneToOBB",	"World::PlaneToCircle",		"World::PlaneToPlane"	}
+};
+
+BodyHandle World::AddActor(Object* Actor)
+{
+	if (Actor->GetStore() != nullptr)
+		return Actor->GetHandle();
+
+	Bodies.Add(Actor);
+
+	if (PairFinder != nullptr)
+		PairFinder->AddActor(Actor);
+
+	return Actor->GetHandle();
+}
+
+void World::RemoveActor(Object* Actor)
+{
+	if (Actor->GetStore() != &Bodies)
+		return;
+
+	PendingRemovals.push_back(Actor->GetHandle());
+}
+
+void World::RemoveActor(const BodyHandle Handle)
+{
+	if (Bodies.IsValid(Handle))
+		PendingRemovals.push_back(Handle);
+}
+
+void World::FlushRemovals()
+{
+	if (PendingRemovals.empty())
+		return;
+
+	Removed.clear();
+
+	for (const BodyHandle Handle : PendingRemovals)
+	{
+		Object* Actor = Bodies.Get(Handle);
+
+		// Queued more than once and already gone
+		if (Actor == nullptr)
+			continue;
+
+		Bodies.Remove(Actor->GetBodyIndex());
+		Removed.push_back(Actor);
+	}
+
+	PendingRemovals.clear();
+
+	if (PairFinder != nullptr)
+		PairFinder->RemoveActors(Removed);
+
+	// The last contacts may point at actors that are about to be torn down
+	if (!Removed.empty())
+		Contacts.clear();
+
+	for (Object* Actor : Removed)
+		Recycle(Actor);
+}
+
+Circle* World::SpawnCircle(const glm::vec2 Location, const glm::vec2 Velocity, const float Radius, const float Mass, const glm::vec4 Color)
+{
+	Circle* Actor = CirclePool.Acquire(Location, Velocity, Radius, Mass, Color);
+	AddActor(Actor);
+
+	return Actor;
+}
+
+class AABB* World::SpawnAABB(const glm::vec2 Location, const glm::vec2 Velocity, const float Width, const float Height, const float Mass, const glm::vec4 Color)
+{
+	class AABB* Actor = AABBPool.Acquire(Location, Velocity, Width, Height, Mass, Color);
+	AddActor(Actor);
+
+	return Actor;
+}
+
+class OBB* World::SpawnOBB(const glm::vec2 Location, const glm::vec2 Velocity, const glm::vec2 Extent, const float Rotation, const float Mass, const glm::vec4 Color)
+{
+	class OBB* Actor = OBBPool.Acquire(Location, Velocity, Extent, Rotation, Mass, Color);
+	AddActor(Actor);
+
+	return Actor;
+}
+
+void World::ReservePool(const Geometry Shape, const unsigned int Capacity)
+{
+	switch (Shape)
+	{
+	case CIRCLE:
+		CirclePool.Reserve(Capacity);
+		break;
+	case Geometry::AABB:
+		AABBPool.Reserve(Capacity);
+		break;
+	case Geometry::OBB:
+		OBBPool.Reserve(Capacity);
+		break;
+	default:
+		break;
+	}
+}
+
+const PoolStats& World::GetPoolStats(const Geometry Shape) const
+{
+	static const PoolStats NO_POOL;
+
+	switch (Shape)
+	{
+	case CIRCLE:
+		return CirclePool.GetStats();
+	case Geometry::AABB:
+		return AABBPool.GetStats();
+	case Geometry::OBB:
+		return OBBPool.GetStats();
+	default:
+		return NO_POOL;
+	}
+}
+
+void World::Recycle(Object* Actor)
+{
+	// Actors the caller made themselves aren't in any pool and are left alone
+	switch (Actor->GetShape())
+	{
+	case CIRCLE:
+		CirclePool.Release(static_cast<Circle*>(Actor));
+		break;
+	case Geometry::AABB:
+		AABBPool.Release(static_cast<class AABB*>(Actor));
+		break;
+	case Geometry::OBB:
+		OBBPool.Release(static_cast<class OBB*>(Actor));
+		break;
+	default:
+		break;
+	}
+}
+
+void World::Update(const float DeltaTime)
+{
+	AccumulatedTime += DeltaTime;
+	
+	if (AccumulatedTime >= 0.2f)
+		AccumulatedTime = 0.2f;
+
+	TRACE_ZONE("World::Update");
+	Profiler.BeginFrame();
+	
+	while (AccumulatedTime >= DeltaTime)
+	{
+		Profiler.GetCurrent().Substeps++;
+
+		{
+			ScopedPhaseTimer Timer(Profiler, PHASE_CONTINUOUS);
+			GatherBullets();
+		}
+
+		{
+			TRACE_ZONE("Integrate");
+			ScopedPhaseTimer Timer(Profiler, PHASE_INTEGRATE);
+			Integrator::Integrate(Bodies, Gravity, TimeStep, Integration);
+			UpdateBoxFrames();
+		}
+
+		if (!Bullets.empty())
+		{
+			TRACE_ZONE("Continuous");
+			ScopedPhaseTimer Timer(Profiler, PHASE_CONTINUOUS);
+			SweepBullets();
+		}
+
+		// Only dynamic bodies can leave the bounds. They are queued, so nothing moves under the loop, and all go in one flush
+		for (unsigned int i = 0; i < Bodies.GetDynamicCount(); i++)
+		{
+			Object* Actor = Bodies.Owners[i];
+
+			if (Actor->IsOutside(Region))
+				RemoveActor(Actor);
+		}
+
+		FlushRemovals();
+	
+		CheckForCollisions();
+	
+		AccumulatedTime -= TimeStep;
+	}
+
+	for (unsigned int i = 0; i < Bodies.GetDynamicCount(); i++)
+	{
+		if (Bodies.IsAwake(i))
+			Profiler.GetCurrent().BodiesAwake++;
+	}
+
+	Profiler.EndFrame();
+}
+
+void World::UpdateBoxFrames()
+{
+	for (Object* Actor : Bodies.Owners)
+	{
+		if (Actor->GetShape() == Geometry::OBB)
+			static_cast<class OBB*>(Actor)->UpdateFrame();
+	}
+}
+
+void World::GatherBullets()
+{
+	Bullets.clear();
+
+	for (unsigned int i = 0; i < Bodies.GetDynamicCount(); i++)
+	{
+		// Bullets are rare, skip 32 bodies at a time when none of them are
+		if (Bodies.BulletMask[i >> 5] == 0)
+		{
+			i |= 31;
+			continue;
+		}
+
+		if (Bodies.IsBullet(i) && Bodies.IsAwake(i) && Bodies.Owners[i]->GetShape() == CIRCLE)
+			Bullets.push_back({ i, { Bodies.PositionX[i], Bodies.PositionY[i] } });
+	}
+}
+
+void World::SweepBullets()
+{
+	for (const BulletStart& Bullet : Bullets)
+	{
+		const unsigned int Index = Bullet.Index;
+		Object* Actor = Bodies.Owners[Index];
+		const float Radius = Bodies.Radius[Index];
+
+		glm::vec2 Start = Bullet.Location;
+		glm::vec2 End = { Bodies.PositionX[Index], Bodies.PositionY[Index] };
+		glm::vec2 Velocity = { Bodies.VelocityX[Index], Bodies.VelocityY[Index] };
+
+		// Share of the step still to move through
+		float Remaining = 1.0f;
+		int Impacts = 0;
+
+		for (; Impacts < MAX_BULLET_IMPACTS; Impacts++)
+		{
+			const glm::vec2 Motion = End - Start;
+			const float Length = sqrtf(dot(Motion, Motion));
+
+			if (Length <= BULLET_SKIN)
+				break;
+
+			const Bounds Swept = { glm::min(Start, End) - Radius, glm::max(Start, End) + Radius };
+
+			ImpactResult Hit;
+			const Object* HitActor = nullptr;
+
+			// Only the static range, it's the same for every bullet and there are few of both
+			for (unsigned int Other = Bodies.GetDynamicCount(); Other < Bodies.GetCount(); Other++)
+			{
+				const Object* Target = Bodies.Owners[Other];
+				ImpactResult Result;
+
+				if (!Broadphase::Overlaps(Swept, Target->GetBounds()) || !Broadphase::ShouldCollide(Actor, Target))
+					continue;
+
+				if (SweepCircle(Start, Motion, Radius, *Target, Result) && Result.Fraction < Hit.Fraction)
+				{
+					Hit = Result;
+					HitActor = Target;
+				}
+			}
+
+			if (HitActor == nullptr)
+				break;
+
+			// Stop just short of the surface, the narrowphase picks the contact up from there
+			const float Fraction = glm::max(Hit.Fraction - BULLET_SKIN / Length, 0.0f);
+			Start += Motion * Fraction;
+			Remaining *= 1.0f - Fraction;
+
+			// Bounce here rather than in the solver, so the rest of the step carries on in the new direction.
+			// Same restitution the solver would use, planes only count the body's own
+			const float Restitution = HitActor->GetShape() == PLANE ? Actor->GetRestitution() : glm::min(Actor->GetRestitution(), HitActor->GetRestitution()) / 2.0f;
+			const float ClosingVelocity = dot(Velocity, Hit.Normal);
+
+			if (ClosingVelocity < 0.0f)
+				Velocity -= Hit.Normal * ((1.0f + Restitution) * ClosingVelocity);
+
+			End = Start + Velocity * (TimeStep * Remaining);
+		}
+
+		// Still hitting things after that many bounces, wait at the last one until the next step
+		if (Impacts == MAX_BULLET_IMPACTS)
+			End = Start;
+
+		Bodies.PositionX[Index] = End.x;
+		Bodies.PositionY[Index] = End.y;
+		Bodies.VelocityX[Index] = Velocity.x;
+		Bodies.VelocityY[Index] = Velocity.y;
+	}
+}
+
+bool World::SweepCircle(const glm::vec2 Start, const glm::vec2 Motion, const float Radius, const Object& Target, ImpactResult& Out)
+{
+	switch (Target.GetShape())
+	{
+	case PLANE:
+	{
+		const auto& Line = static_cast<const Plane&>(Target);
+		return TimeOfImpact::CircleToSegment(Start, Motion, Radius, Line.GetStart(), Line.GetEnd(), Out);
+	}
+	case CIRCLE:
+		return TimeOfImpact::CircleToCircle(Start, Motion, Radius, Target.GetLocation(), static_cast<const Circle&>(Target).GetRadius(), Out);
+	case Geometry::AABB:
+		return TimeOfImpact::CircleToBox(Start, Motion, Radius, Target.GetLocation(), static_cast<const class AABB&>(Target).GetExtent(), { 1.0f, 0.0f }, { 0.0f, 1.0f }, Out);
+	case Geometry::OBB:
+	{
+		const auto& Box = static_cast<const class OBB&>(Target);
+		return TimeOfImpact::CircleToBox(Start, Motion, Radius, Box.GetLocation(), Box.GetExtent(), Box.GetAxisX(), Box.GetAxisY(), Out);
+	}
+	default:
+		return false;
+	}
+}
+
+void World::SetIntegratorPath(const IntegratorPath Path)
+{
+	// Never pick a path the CPU can't run
+	Integration = Path > Integrator::DetectPath() ? Integrator::DetectPath() : Path;
+}
+
+void World::SetCircleBatchPath(const IntegratorPath Path)
+{
+	CircleBatchPath = Path > Integrator::DetectPath() ? Integrator::DetectPath() : Path;
+}
+
+void World::SetSleeping(const bool State)
+{
+	bSleeping = State;
+
+	if (!bSleeping)
+	{
+		for (unsigned int i = 0; i < Bodies.GetCount(); i++)
+			Bodies.SetAwake(i, true);
+	}
+}
+
+void World::SetThreadCount(const unsigned int Count)
+{
+	ThreadCount = Count > 0 ? Count : 1;
+
+	delete Workers;
+	Workers = ThreadCount > 1 ? new WorkerPool(ThreadCount) : nullptr;
+}
+
+void World::SetBroadphase(const BroadphaseMethod Method)
+{
+	this->Method = Method;
+
+	delete PairFinder;
+	PairFinder = nullptr;
+
+	switch (Method)
+	{
+	case UNIFORM_GRID:
+		PairFinder = new UniformGrid(GridCellSize, Region.Min, Region.Max);
+		break;
+
+	case SWEEP_AND_PRUNE:
+		PairFinder = new SweepAndPrune();
+		break;
+
+	case DYNAMIC_TREE:
+	{
+		auto* Tree = new TreeBroadphase();
+		Tree->SetMargin(TreeMargin);
+		PairFinder = Tree;
+		break;
+	}
+
+	default:
+		break;
+	}
+
+	if (PairFinder != nullptr)
+	{
+		for (auto Actor : Bodies.Owners)
+			PairFinder->AddActor(Actor);
+	}
+}
+
+void World::SetGridCellSize(const float CellSize)
+{
+	GridCellSize = CellSize;
+
+	if (Method == UNIFORM_GRID)
+		static_cast<UniformGrid*>(PairFinder)->SetCellSize(CellSize);
+}
+
+void World::SetBounds(const Bounds& Region)
+{
+	this->Region = Region;
+
+	if (Method == UNIFORM_GRID)
+		static_cast<UniformGrid*>(PairFinder)->SetRegion(Region.Min, Region.Max);
+}
+
+void World::SetTreeMargin(const float Margin)
+{
+	TreeMargin = Margin;
+
+	if (Method == DYNAMIC_TREE)
+		static_cast<TreeBroadphase*>(PairFinder)->SetMargin(Margin);
+}
+
+void World::QueryRegion(const Bounds& Region, std::vector<Object*>& OutActors) const
+{
+	if (Method == DYNAMIC_TREE)
+	{
+		static_cast<TreeBroadphase*>(PairFinder)->QueryRegion(Region, OutActors);
+		return;
+	}
+
+	for (auto Actor : Bodies.Owners)
+	{
+		if (Broadphase::Overlaps(Region, Actor->GetBounds()))
+			OutActors.push_back(Actor);
+	}
+}
+
+void World::CheckForCollisions()
+{
+	TRACE_ZONE("World::CheckForCollisions");
+
+	Contacts.clear();
+
+	FindContacts();
+	Profiler.GetCurrent().ContactsProduced += Contacts.size();
+
+	ResolveContacts();
+}
+
+void World::FindContacts()
+{
+	if (PairFinder == nullptr)
+	{
+		TRACE_ZONE("Narrowphase brute force");
+		ScopedPhaseTimer Timer(Profiler, PHASE_NARROWPHASE);
+
+		const std::vector<Object*>& Actors = Bodies.Owners;
+		const int ActorCount = Actors.size();
+		const int DynamicCount = Bodies.GetDynamicCount();
+
+		// Static bodies sit after the dynamic ones and are never tested against each other
+		for (int Outer = 0; Outer < DynamicCount; Outer++)
+		{
+			for (int Inner = Outer + 1; Inner < ActorCount; Inner++)
+			{
+				if ((Bodies.IsActive(Outer) || Bodies.IsActive(Inner)) && Broadphase::ShouldCollide(Actors[Outer], Actors[Inner]))
+				{
+					CheckPair(Actors[Outer], Actors[Inner], Contacts);
+					Profiler.GetCurrent().PairsTested++;
+				}
+			}
+		}
+
+		return;
+	}
+
+	{
+		TRACE_ZONE("Broadphase");
+		ScopedPhaseTimer Timer(Profiler, PHASE_BROADPHASE);
+
+		Pairs.clear();
+		PairFinder->FindPairs(Bodies.Owners, Bodies.GetDynamicCount(), Pairs);
+
+		// The broadphase has seen where the static bodies were moved to
+		Bodies.ClearMoved();
+	}
+
+	ScopedPhaseTimer Timer(Profiler, PHASE_NARROWPHASE);
+
+	const unsigned int PairCount = Pairs.size();
+	Profiler.GetCurrent().PairsTested += PairCount;
+
+	unsigned int ChunkCount = PairCount / MIN_PAIRS_PER_CHUNK;
+
+	if (ChunkCount > ThreadCount)
+		ChunkCount = ThreadCount;
+
+	if (ChunkCount == 0)
+		ChunkCount = 1;
+
+	if (Chunks.size() < ChunkCount)
+		Chunks.resize(ChunkCount);
+
+	for (unsigned int i = 0; i < ChunkCount; i++)
+	{
+		Chunks[i].First = PairCount * i / ChunkCount;
+		Chunks[i].Last = PairCount * (i + 1) / ChunkCount;
+	}
+
+	// Nothing here writes to the bodies, so the chunks can run side by side
+	if (ChunkCount == 1 || Workers == nullptr)
+	{
+		for (unsigned int i = 0; i < ChunkCount; i++)
+			CollideChunk(Chunks[i]);
+	}
+	else
+		Workers->Run(ChunkCount, [this](const unsigned int Index) { CollideChunk(Chunks[Index]); });
+
+	// Merge in chunk order. The chunks are consecutive slices, so this is pair order no matter how many there were
+	for (unsigned int i = 0; i < ChunkCount; i++)
+		Contacts.insert(Contacts.end(), Chunks[i].Manifolds.begin(), Chunks[i].Manifolds.end());
+
+	Manifold M;
+
+	for (unsigned int i = 0; i < ChunkCount; i++)
+	{
+		const NarrowphaseChunk& Chunk = Chunks[i];
+
+		for (const CircleContact& Contact : Chunk.CircleContacts)
+		{
+			M.Reset(Bodies.Owners[Chunk.CircleIndexA[Contact.Pair]], Bodies.Owners[Chunk.CircleIndexB[Contact.Pair]]);
+			M.ContactsCount = 1;
+			M.Penetration = Contact.Penetration;
+			M.Normal = Contact.Normal;
+
+			Contacts.push_back(M);
+		}
+	}
+}
+
+void World::CollideChunk(NarrowphaseChunk& Chunk) const
+{
+	Chunk.Manifolds.clear();
+	Chunk.CircleIndexA.clear();
+	Chunk.CircleIndexB.clear();
+	Chunk.CircleContacts.clear();
+
+	Manifold M;
+
+	for (unsigned int BatchFirst = Chunk.First; BatchFirst < Chunk.Last; BatchFirst += NARROWPHASE_BATCH_SIZE)
+	{
+		const unsigned int BatchLast = BatchFirst + NARROWPHASE_BATCH_SIZE < Chunk.Last ? BatchFirst + NARROWPHASE_BATCH_SIZE : Chunk.Last;
+
+		for (auto& Buckets : Chunk.ShapeBuckets)
+		{
+			for (std::vector<unsigned int>& Bucket : Buckets)
+				Bucket.clear();
+		}
+
+		Chunk.Unordered.clear();
+		Chunk.ManifoldOf.assign(BatchLast - BatchFirst, NO_MANIFOLD);
+
+		// Circle pairs are tested together afterwards, everything else goes through the dispatch table
+		{
+			TRACE_ZONE("Narrowphase dispatch");
+
+			for (unsigned int i = BatchFirst; i < BatchLast; i++)
+			{
+				const CollisionPair& Pair = Pairs[i];
+
+				// Sleeping and static bodies can't push each other
+				if (!Bodies.IsActive(Pair.A->GetBodyIndex()) && !Bodies.IsActive(Pair.B->GetBodyIndex()))
+					continue;
+
+				if (Pair.A->GetShape() == CIRCLE && Pair.B->GetShape() == CIRCLE)
+				{
+					Chunk.CircleIndexA.push_back(Pair.A->GetBodyIndex());
+					Chunk.CircleIndexB.push_back(Pair.B->GetBodyIndex());
+					continue;
+				}
+
+				Chunk.ShapeBuckets[Pair.A->GetShape()][Pair.B->GetShape()].push_back(i);
+			}
+		}
+
+		for (int ShapeA = 0; ShapeA < LAST; ShapeA++)
+		{
+			for (int ShapeB = 0; ShapeB < LAST; ShapeB++)
+			{
+				const std::vector<unsigned int>& Bucket = Chunk.ShapeBuckets[ShapeA][ShapeB];
+
+				if (Bucket.empty())
+					continue;
+
+				TRACE_ZONE(CollisionZoneNames[ShapeA][ShapeB]);
+
+				const CollisionFn CollisionFunctionPtr = CollisionFunctionArray[ShapeA][ShapeB];
+
+				for (const unsigned int Index : Bucket)
+				{
+					M.Reset(Pairs[Index].A, Pairs[Index].B);
+
+					// Keep the ones that actually touched, with all their points so the solver can balance them against each other
+					if (CollisionFunctionPtr(&M) && M.ContactsCount > 0)
+					{
+						Chunk.ManifoldOf[Index - BatchFirst] = Chunk.Unordered.size();
+						Chunk.Unordered.push_back(M);
+					}
+				}
+			}
+		}
+
+		for (const unsigned int Found : Chunk.ManifoldOf)
+		{
+			if (Found != NO_MANIFOLD)
+				Chunk.Manifolds.push_back(Chunk.Unordered[Found]);
+		}
+	}
+
+	TRACE_ZONE("CircleBatch::Collide");
+	CircleBatch::Collide(Bodies, Chunk.CircleIndexA, Chunk.CircleIndexB, Chunk.CircleContacts, CircleBatchPath);
+}
+
+void World::CheckPair(Object* Object1, Object* Object2, std::vector<Manifold>& OutContacts)
+{
+	Manifold M;
+	M.Reset(Object1, Object2);
+
+	const CollisionFn CollisionFunctionPtr = CollisionFunctionArray[Object1->GetShape()][Object2->GetShape()];
+
+	// Keep the ones that actually touched, with all their points so the solver can balance them against each other
+	if (CollisionFunctionPtr(&M) && M.ContactsCount > 0)
+		OutContacts.push_back(M);
+}
+
+void World::ResolveContacts()
+{
+	// Circles light up when they touch a kinematic plane
+	for (const Manifold& M : Contacts)
+	{
+		if (M.A->GetShape() == PLANE && M.B->GetShape() == CIRCLE && M.A->IsKinematic())
+			static_cast<Circle*>(M.B)->Collided = true;
+		else if (M.B->GetShape() == PLANE && M.A->GetShape() == CIRCLE && M.B->IsKinematic())
+			static_cast<Circle*>(M.A)->Collided = true;
+	}
+
+	{
+		TRACE_ZONE("ContactSolver::Solve");
+		ScopedPhaseTimer Timer(Profiler, PHASE_SOLVE);
+		Solver.Solve(Contacts, Bodies, TimeStep);
+	}
+
+	if (bSleeping)
+	{
+		TRACE_ZONE("IslandManager::Update");
+		ScopedPhaseTimer Timer(Profiler, PHASE_SLEEP);
+		Islands.Update(Bodies, Contacts, TimeStep, TimeToSleep);
+	}
+}
+
+// The shapes behind a pair, as the kernels in Narrowphase take them. OBBs hand over the axes UpdateBoxFrames cached
+static CircleShape MakeCircle(const ::Circle& Ball)
+{
+	return { Ball.GetLocation(), Ball.GetRadius() };
+}
+
+static BoxShape MakeBox(const class AABB& Rec)
+{
+	return { Rec.GetLocation(), { glm::vec2(1.0f, 0.0f), glm::vec2(0.0f, 1.0f) }, Rec.GetExtent() };
+}
+
+static BoxShape MakeBox(const class OBB& Box)
+{
+	return { Box.GetLocation(), { Box.GetAxisX(), Box.GetAxisY() }, Box.GetExtent() };
+}
+
+static SegmentShape MakeSegment(const ::Plane& Line)
+{
+	return { Line.GetStart(), Line.GetEnd(), Line.GetNormal() };
+}
+
+bool World::AABBToAABB(Manifold* M)
+{
+	return Narrowphase::BoxToBox(MakeBox(*static_cast<class AABB*>(M->A)), MakeBox(*static_cast<class AABB*>(M->B)), M);
+}
+
+bool World::AABBToCircle(Manifold* M)
+{
+	return Narrowphase::BoxToCircle(MakeBox(*static_cast<class AABB*>(M->A)), MakeCircle(*static_cast<::Circle*>(M->B)), M);
+}
+
+bool World::OBBToAABB(Manifold* M)
+{
+	return Narrowphase::BoxToBox(MakeBox(*static_cast<class OBB*>(M->A)), MakeBox(*static_cast<class AABB*>(M->B)), M);
+}
+
+bool World::OBBToCircle(Manifold * M)
+{
+	return Narrowphase::BoxToCircle(MakeBox(*static_cast<class OBB*>(M->A)), MakeCircle(*static_cast<::Circle*>(M->B)), M);
+}
+
+bool World::OBBToOBB(Manifold * M)
+{
+	return Narrowphase::BoxToBox(MakeBox(*static_cast<class OBB*>(M->A)), MakeBox(*static_cast<class OBB*>(M->B)), M);
+}
+
+bool World::CircleToCircle(Manifold* M)
+{
+	return Narrowphase::CircleToCircle(MakeCircle(*static_cast<::Circle*>(M->A)), MakeCircle(*static_cast<::Circle*>(M->B)), M);
+}
+
+bool World::PlaneToAABB(Manifold* M)
+{
+	return Narrowphase::SegmentToBox(MakeSegment(*static_cast<::Plane*>(M->A)), MakeBox(*static_cast<class AABB*>(M->B)), M);
+}
+
+bool World::PlaneToCircle(Manifold* M)
+{
+	return Narrowphase::SegmentToCircle(MakeSegment(*static_cast<::Plane*>(M->A)), MakeCircle(*static_cast<::Circle*>(M->B)), M);
+}
+
+bool World::PlaneToOBB(Manifold* M)
+{
+	return Narrowphase::SegmentToBox(MakeSegment(*static_cast<::Plane*>(M->A)), MakeBox(*static_cast<class OBB*>(M->B)), M);
+}
+
+bool World::PlaneToPlane(Manifold*)
+{
+	return false;
+}
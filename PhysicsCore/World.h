@@ -0,0 +1,226 @@
+﻿#pragma once
+#include "Object.h"
+
+#include <vector>
+#include "Manifold.h"
+#include "Broadphase.h"
+#include "Integrator.h"
+#include "CircleBatch.h"
+#include "WorkerPool.h"
+#include "ContactSolver.h"
+#include "IslandManager.h"
+#include "StepProfiler.h"
+#include "ObjectPool.h"
+#include "TimeOfImpact.h"
+#include "AABB.h"
+#include "Circle.h"
+#include "OBB.h"
+
+#define WHITE {1.0f, 1.0f, 1.0f, 1.0f}
+#define RED {1.0f, 0.0f, 0.0f, 1.0f}
+#define GREEN {0.0f, 1.0f, 0.0f, 1.0f}
+#define BLUE {0.0f, 0.0f, 1.0f, 1.0f}
+#define LIGHT_BLUE {0.0f, 1.0f, 1.0f, 1.0f}
+#define YELLOW {1.0f, 1.0f, 0.0f, 1.0f}
+
+class World
+{
+public:
+	World();
+	~World();
+
+	// The handle stays valid until the actor is removed, adding an actor twice hands back the same one
+	BodyHandle AddActor(Object* Actor);
+
+	// Queued, the actor stays in the World until the next FlushRemovals. Queuing the same actor twice is harmless
+	void RemoveActor(Object* Actor);
+	void RemoveActor(BodyHandle Handle);
+
+	// Takes out everything queued for removal. Update calls this after integrating each step,
+	// call it yourself before deleting an actor queued outside Update
+	void FlushRemovals();
+
+	// nullptr once the actor has been removed
+	Object* GetActor(const BodyHandle Handle) const { return Bodies.Get(Handle); }
+
+	// Built in the World's own pools and added straight away. The World owns these, once they are removed,
+	// by Despawn or by leaving the window, their slot is reused and the pointer must not be touched again
+	Circle* SpawnCircle(glm::vec2 Location, glm::vec2 Velocity, float Radius, float Mass, glm::vec4 Color);
+	class AABB* SpawnAABB(glm::vec2 Location, glm::vec2 Velocity, float Width, float Height, float Mass, glm::vec4 Color);
+	class OBB* SpawnOBB(glm::vec2 Location, glm::vec2 Velocity, glm::vec2 Extent, float Rotation, float Mass, glm::vec4 Color);
+
+	// RemoveActor under the name that goes with Spawn, the slot is free again after the next flush
+	void Despawn(Object* Actor) { RemoveActor(Actor); }
+
+	// Room for this many actors of one shape, so spawning them never allocates. Planes aren't pooled
+	void ReservePool(Geometry Shape, unsigned int Capacity);
+	const PoolStats& GetPoolStats(Geometry Shape) const;
+
+	void Update(float DeltaTime);
+
+	const BodyStore& GetBodies() const { return Bodies; }
+
+	void CheckForCollisions();
+
+	// The manifolds of the pairs that touched during the last CheckForCollisions
+	const std::vector<Manifold>& GetContacts() const { return Contacts; }
+
+	// Brute force tests every actor against every other actor, kept around to benchmark against the broadphase
+	void SetBroadphase(BroadphaseMethod Method);
+	BroadphaseMethod GetBroadphase() const { return Method; }
+
+	void SetGridCellSize(float CellSize);
+	float GetGridCellSize() const { return GridCellSize; }
+
+	void SetTreeMargin(float Margin);
+	float GetTreeMargin() const { return TreeMargin; }
+
+	// Where bodies are allowed to be. Dynamic bodies that leave it are removed, and the uniform grid is laid over it
+	void SetBounds(const Bounds& Region);
+	const Bounds& GetBounds() const { return Region; }
+
+	// Defaults to the widest path the CPU supports. Forcing scalar is useful to compare against
+	void SetIntegratorPath(IntegratorPath Path);
+	IntegratorPath GetIntegratorPath() const { return Integration; }
+
+	// Same for the circle pair narrowphase, set on its own so either side can be compared alone. Only AVX has a wide kernel there
+	void SetCircleBatchPath(IntegratorPath Path);
+	IntegratorPath GetCircleBatchPath() const { return CircleBatchPath; }
+
+	// Velocity passes the contact solver makes each step, more settles stacks better
+	void SetSolverIterations(int Iterations) { Solver.SetIterations(Iterations); }
+	int GetSolverIterations() const { return Solver.GetIterations(); }
+
+	// Start each contact from the impulse it needed last step
+	void SetWarmStarting(bool State) { Solver.SetWarmStarting(State); }
+	bool IsWarmStarting() const { return Solver.IsWarmStarting(); }
+
+	// Islands that stay below the sleep thresholds for this long stop being simulated until something touches them
+	void SetSleeping(bool State);
+	bool IsSleeping() const { return bSleeping; }
+
+	void SetTimeToSleep(const float Seconds) { TimeToSleep = Seconds; }
+	float GetTimeToSleep() const { return TimeToSleep; }
+
+	unsigned int GetIslandCount() const { return Islands.GetIslandCount(); }
+
+	// Threads the narrowphase is split over. Contacts come out in the same order whatever the count, 1 runs everything on the calling thread
+	void SetThreadCount(unsigned int Count);
+	unsigned int GetThreadCount() const { return ThreadCount; }
+
+	// Per phase timings and counters for the last StepProfiler::HISTORY_LENGTH calls to Update
+	const StepProfiler& GetProfiler() const { return Profiler; }
+
+	// Hardware counters around each phase on top of the timers. Linux only, and they only see the thread calling Update,
+	// so run the narrowphase on one thread when reading them. Returns false when none could be opened
+	bool SetHardwareCounters(bool State) { return Profiler.SetCounters(State); }
+	bool HasHardwareCounters() const { return Profiler.HasCounters(); }
+
+	// Every actor whose bounds overlap the region
+	void QueryRegion(const Bounds& Region, std::vector<Object*>& OutActors) const;
+
+	// Narrowphase routines, A is always the shape named first. They only fill in the manifold, nothing moves until the solver runs
+	static bool AABBToAABB(Manifold* M);
+	static bool AABBToCircle(Manifold* M);
+	static bool OBBToAABB(Manifold* M);
+	static bool OBBToCircle(Manifold* M);
+	static bool OBBToOBB(Manifold* M);
+	static bool CircleToCircle(Manifold* M);
+	static bool PlaneToAABB(Manifold* M);
+	static bool PlaneToCircle(Manifold* M);
+	static bool PlaneToOBB(Manifold* M);
+	static bool PlaneToPlane(Manifold* M);
+
+	glm::vec2 Gravity{};
+	float TimeStep{};
+
+private:
+	// Frame time not simulated yet, per World so separate Worlds step independently
+	float AccumulatedTime{};
+
+	BodyStore Bodies;
+
+	// Handles rather than pointers, anything removed in the meantime goes stale and is skipped
+	std::vector<BodyHandle> PendingRemovals;
+	std::vector<Object*> Removed;
+
+	// Where each awake bullet was before integrating, so its whole motion can be swept afterwards
+	struct BulletStart
+	{
+		unsigned int Index;
+		glm::vec2 Location;
+	};
+
+	std::vector<BulletStart> Bullets;
+
+	// Refreshes every OBB's cached axes and corners after they move, before the broadphase and narrowphase read them
+	void UpdateBoxFrames();
+
+	void GatherBullets();
+	void SweepBullets();
+
+	static bool SweepCircle(glm::vec2 Start, glm::vec2 Motion, float Radius, const Object& Target, ImpactResult& Out);
+
+	ObjectPool<Circle> CirclePool;
+	ObjectPool<class AABB> AABBPool;
+	ObjectPool<class OBB> OBBPool;
+
+	// Hands a removed actor back to its pool, if it came from one
+	void Recycle(Object* Actor);
+
+	IntegratorPath Integration{INTEGRATOR_SCALAR};
+	IntegratorPath CircleBatchPath{INTEGRATOR_SCALAR};
+
+	BroadphaseMethod Method{UNIFORM_GRID};
+	Broadphase* PairFinder{};
+	std::vector<CollisionPair> Pairs;
+	std::vector<Manifold> Contacts;
+
+	ContactSolver Solver;
+
+	IslandManager Islands;
+	bool bSleeping{true};
+	float TimeToSleep{0.5f};
+
+	// A slice of the pair list and everything one worker found in it
+	struct NarrowphaseChunk
+	{
+		unsigned int First{}, Last{};
+
+		std::vector<Manifold> Manifolds;
+
+		// Pairs that aren't two circles, bucketed by their shapes so each routine runs under one trace zone. Manifolds come
+		// out bucket by bucket, ManifoldOf says which one each pair made so they can be put back in pair order
+		std::vector<unsigned int> ShapeBuckets[LAST][LAST];
+		std::vector<Manifold> Unordered;
+		std::vector<unsigned int> ManifoldOf;
+
+		// Circle pairs, as body indices for CircleBatch
+		std::vector<unsigned int> CircleIndexA, CircleIndexB;
+		std::vector<CircleContact> CircleContacts;
+	};
+
+	std::vector<NarrowphaseChunk> Chunks;
+
+	StepProfiler Profiler;
+
+	WorkerPool* Workers{};
+	unsigned int ThreadCount{1};
+
+	float GridCellSize{8.0f};
+	float TreeMargin{2.0f};
+
+	// A little past the edges of the app's window
+	Bounds Region{ { -110.0f, -110.0f }, { 110.0f, 110.0f } };
+
+	void CollideChunk(NarrowphaseChunk& Chunk) const;
+
+	// Fills Contacts from the broadphase, or from every pair when brute forcing
+	void FindContacts();
+
+	// Hands the merged contacts to the solver, then lets settled islands sleep
+	void ResolveContacts();
+
+	static void CheckPair(Object* Object1, Object* Object2, std::vector<Manifold>& OutContacts);
+};
+
@@ -3,6 +3,7 @@
 #include <GLFW/glfw3.h>
 #include "Input.h"
 #include "imgui_glfw3.h"
+#include "Trace.h"
 
 namespace aie {
 
@@ -78,6 +79,8 @@ void Application::run(const char* title, int width, int height, bool fullscreen)
 		// loop while game is running
 		while (!m_gameOver) {
 
+			TRACE_ZONE("Application::run frame");
+
 			// Update delta time
 			currTime = glfwGetTime();
 			deltaTime = currTime - prevTime;
@@ -105,9 +108,15 @@ void Application::run(const char* title, int width, int height, bool fullscreen)
 			// clear imgui
 			ImGui_NewFrame();
 
-			Update(float(deltaTime));
+			{
+				TRACE_ZONE("Application::Update");
+				Update(float(deltaTime));
+			}
 
-			Draw();
+			{
+				TRACE_ZONE("Application::Draw");
+				Draw();
+			}
 
 			// Draw IMGUI last
 			ImGui::Render();
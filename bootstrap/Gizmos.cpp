@@ -3,6 +3,7 @@
 #include <glm/glm.hpp>
 #include <glm/ext.hpp>
 #include <iostream>
+#include "Trace.h"
 
 namespace aie {
 
@@ -999,6 +1000,8 @@ void Gizmos::draw2D(float screenWidth, float screenHeight) {
 }
 
 void Gizmos::draw2D(const glm::mat4& projection) {
+	TRACE_ZONE("Gizmos::draw2D");
+
 	if ( sm_singleton != nullptr && 
 		(sm_singleton->m_2DlineCount > 0 || 
 		 sm_singleton->m_2DtriCount > 0)) {
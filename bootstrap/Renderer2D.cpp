@@ -5,6 +5,7 @@
 #include "Font.h"
 #include <glm/ext.hpp>
 #include <stb_truetype.h>
+#include "Trace.h"
 
 namespace aie {
 
@@ -643,6 +644,7 @@ bool Renderer2D::shouldFlush(int additionalVertices, int additionalIndices) {
 }
 
 void Renderer2D::flushBatch() {
+	TRACE_ZONE("Renderer2D::flushBatch");
 
 	// dont render anything
 	if (m_currentVertex == 0 || m_currentIndex == 0 || m_renderBegun == false)